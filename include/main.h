@@ -55,6 +55,7 @@
 #define MODEM_LINK_READY 120
 
 #define MODEM_V2G_INIT 121
+#define MODEM_LINK_CHECK 122 /* is the EV still in our AVLN? Counts the GET_SW.CNF */
 
 
 /*====================================================================*
@@ -101,15 +102,85 @@
 
 /* V2GTP */
 #define V2GTP_HEADER_SIZE 8 /* header has 8 bytes */
+/* payload types. DIN and ISO 15118-2 send all EXI messages as 0x8001. ISO 15118-20 uses 0x8001 only
+   for the supportedAppProtocol handshake, and one payload type per message set after it. */
+#define V2GTP_PAYLOAD_EXI 0x8001
+#define V2GTP_PAYLOAD_ISO20_MAIN 0x8002 /* ISO 15118-20 common messages */
+#define V2GTP_PAYLOAD_ISO20_AC 0x8003
+#define V2GTP_PAYLOAD_ISO20_DC 0x8004
+#define V2GTP_PAYLOAD_ISO20_ACDP 0x8005
+#define V2GTP_PAYLOAD_ISO20_WPT 0x8006
+
+// Timer20ms task
+#define TIMER_POLL_MS 20      // modem poll period
+#define TIMER_POLL_FAST_MS 2  // during the CurrentDemand loop
+
+// Limits of the charger, sent to the EV in the ChargeParameterDiscoveryRes and CurrentDemandRes
+#define EVSE_MAXIMUM_VOLTAGE 500      // V
+#define EVSE_MINIMUM_VOLTAGE 150      // V
+#define EVSE_MAXIMUM_CURRENT 125      // A
+#define EVSE_MINIMUM_CURRENT 0        // A
+#define EVSE_MAXIMUM_POWER 50000      // W
+#define EVSE_PEAK_CURRENT_RIPPLE 2    // A
+
+#define SOC_ONLY_SESSION 1 /* end the V2G session once we have the SoC. 0 runs the DC charge loop, for a charger with a power stage */
+
+// SoC refresh while the EV charges on AC, see soc.cpp
+#define SOC_REFRESH_INTERVAL_MS (10 * 60 * 1000UL) // the first refresh after the plug-in, configurable on the web page
+#define SOC_REFRESH_MIN_MS (2 * 60 * 1000UL)
+#define SOC_REFRESH_MAX_MS (60 * 60 * 1000UL)
+#define SOC_REFRESH_STEP 2                // % the SoC should change from one refresh to the next
+#define SOC_REFRESH_TIMEOUT_MS 60000      // for the SoC of a requested session
+#define SOC_REFRESH_RETRIES 3
+
+// SoC estimate from the power the SmartEVSE pushes to /api/power, see soc.cpp
+#define SOC_CHARGE_EFFICIENCY 0.9f        // AC to battery, until the EV's reads teach us better
+#define SOC_EFFICIENCY_MIN 0.5f
+#define SOC_ESTIMATE_ERROR 0.2f           // relative error of the estimated change, until learned
+#define SOC_ESTIMATE_ERROR_MIN 0.02f
+#define SOC_ESTIMATE_MAX_UNCERTAINTY 5.0f // % SoC at which the confidence reaches 0
+#define SOC_LEARN_MIN_CHANGE 3            // % of the capacity that must go in before a read teaches the efficiency
+#define SOC_POWER_TIMEOUT_MS 30000        // a power reading older than this is no reading
+#define SOC_ESTIMATE_PUBLISH_MS 10000     // at most one estimate callback per period
+#define SOC_ESTIMATE_PUBLISH_STEP 0.1f    // % SoC
+
+// SLAC. Each phase ends as soon as its data is complete, the timers only cover lost messages
+#define SLAC_SOUNDS 10                // CM_MNBC_SOUND.IND we expect, unless the CM_START_ATTEN_CHAR.IND announces another number
+#define SLAC_CANDIDATES 4             // EVs whose SLAC we follow at the same time, the first one to send a CM_SLAC_MATCH.REQ is matched
+#define MODEM_SEARCH_TIMEOUT_MS 1000  // for the GET_SW.CNF of both modems, then the GET_SW.REQ is repeated
+
+// ISO 15118-3 SLAC timers of the EVSE, see slacSteps[] in slac.cpp
+#define TT_EVSE_SLAC_INIT_MS 50000    // a CM_SLAC_PARAM.REQ after a longer silence comes from a new plug-in
+#define TT_MATCH_SEQUENCE_MS 400      // CM_SLAC_PARAM.CNF to CM_START_ATTEN_CHAR.IND
+#define TT_EVSE_MATCH_MNBC_MS 600     // CM_START_ATTEN_CHAR.IND to the last sound
+#define TT_MATCH_RESPONSE_MS 200      // CM_ATTEN_CHAR.IND to CM_ATTEN_CHAR.RSP, then the IND is repeated
+#define C_EV_MATCH_RETRY 2            // repeats of the CM_ATTEN_CHAR.IND
+#define TT_EVSE_MATCH_SESSION_MS 10000 // CM_ATTEN_CHAR.RSP to CM_SLAC_MATCH.REQ
+#define TT_MATCH_JOIN_MS 12000        // CM_SLAC_MATCH.CNF until both modems answer the GET_SW.REQ
+
+// Session lifecycle
+#define SET_KEY_TIMEOUT_MS 500        // for the SET_KEY.CNF, then the SET_KEY.REQ is repeated
+#define SET_KEY_RETRIES 3             // then the modem is reset
+#define LINK_CHECK_INTERVAL_MS 10000  // while the EV stays in our AVLN without a session
+
+// Failure recovery, see recovery.cpp
+#define RECOVERY_WINDOW_MS 60000      // failures further apart do not add up
+#define RECOVERY_BACKOFF_STEPS 7      // failures counted for the backoff, which doubles with each one
+#define RECOVERY_BACKOFF_MAX_MS 60000
 
 extern uint8_t txbuffer[], rxbuffer[];
+extern uint8_t modem_state;
 extern uint8_t myMac[];
-extern uint8_t pevMac[];
-extern uint8_t EVCCID[];
+extern uint8_t pevMac[6];
+extern uint8_t EVCCID[6];
 extern uint8_t EVSOC;
+extern unsigned long plugInTimer;
 
-void sendSocCallback(float current_soc, float full_soc, float energy_capacity, float energy_request, const String& evccid);
+void sendSocCallback(float current_soc, float full_soc, float energy_capacity, float energy_request, const String& evccid, uint8_t confidence);
 String macArrayToString(const uint8_t mac[6]); 
+void sessionEnded(const char *reason);
+void rearmModem(const char *reason);
+void ModemReset();
 
 void qcaspi_write_burst(uint8_t *src, uint32_t len);
 void setMacAt(uint8_t *mac, uint16_t offset);
\ No newline at end of file
@@ -0,0 +1,14 @@
+/* The layers a failure can hit, from the bottom of the stack up. A restart of one layer also restarts
+   all layers above it. */
+#define RECOVER_SPI 0   /* a frame from the modem we cannot parse */
+#define RECOVER_MODEM 1
+#define RECOVER_SLAC 2
+#define RECOVER_SDP 3   /* IPv6 and the SECC discovery */
+#define RECOVER_TCP 4
+#define RECOVER_V2G 5
+#define RECOVER_LAYERS 6
+
+void recoverFrom(uint8_t layer, const char *reason);
+void recoverySucceeded(void);
+bool recoveryHolds(uint8_t layer);
+void recovery_poll(void);
@@ -0,0 +1,12 @@
+extern unsigned long ModemSearchTimer;
+extern unsigned long SetKeyTimer;
+extern uint8_t SetKeyRetries;
+extern unsigned long LinkCheckTimer;
+extern uint8_t ModemsFound;
+
+void randomizeNmk();
+void composeSetKey();
+void composeGetSwReq();
+void SlacManager(uint16_t rxbytes);
+void checkSlacTimeouts(void);
+void linkReady(void);
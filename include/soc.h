@@ -0,0 +1,14 @@
+extern uint32_t socRefreshInterval; /* ms, 0 for no refresh */
+
+uint8_t controlPilot_available(void);
+void controlPilot_requestSession(void);
+uint8_t socRefresh_received(uint8_t soc);
+uint8_t socRefresh_scheduled(void);
+void socRefresh_stop(void);
+void socRefresh_poll(void);
+
+void socEstimate_pushPower(float watts);
+void socEstimate_reset(void);
+void socEstimate_correct(uint8_t soc, float fullSoc, float energyCapacity, float energyRequest);
+uint8_t socEstimate_confidence(void);
+void socEstimate_update(unsigned long now);
@@ -1,3 +1,42 @@
 void evaluateTcpPacket(void);
 void tcp_prepareTcpHeader(uint8_t tcpFlag);
-void tcp_packRequestIntoIp(void);
\ No newline at end of file
+void tcp_packRequestIntoIp(void);
+void tcp_sendFinAck(void);
+extern uint8_t v2gProtocol; /* APPHAND_PROTOCOL_* of the running session */
+extern uint16_t appHandNegotiations[]; /* handshakes per APPHAND_PROTOCOL_*, the last entry counts the failed ones */
+
+/* request-to-response time of a V2G message which repeats during the charge */
+#define V2G_LATENCY_BUDGET_US 5000
+
+struct v2gLatency {
+    uint32_t count;
+    uint32_t overBudget; /* responses later than V2G_LATENCY_BUDGET_US */
+    uint32_t lastUs;
+    uint32_t maxUs;
+    uint64_t sumUs;
+    uint32_t preEncoded; /* responses sent from a speculative template */
+};
+
+/* plug-in to a milestone: the link to the EV, or the ChargeParameterDiscoveryReq where the EV tells its SoC */
+struct socTiming {
+    uint32_t count;
+    uint32_t lastMs;
+    uint32_t minMs;
+    uint32_t maxMs;
+    uint32_t sumMs;
+};
+
+extern uint8_t socOnlySession; /* 1: the session ends after the ChargeParameterDiscovery */
+extern struct socTiming plugInToSoc;
+extern uint8_t v2gHotPath; /* 1 while the CurrentDemand loop runs */
+extern struct v2gLatency currentDemandLatency;
+extern float EVSEPresentVoltage, EVSEPresentCurrent;
+
+void powerStage_setTarget(float voltage, float current);
+
+void buildV2GDispatchTable(void);
+void resetV2GSession(const char *reason);
+uint8_t v2gSessionRunning(void);
+uint32_t recordTiming(struct socTiming *timing);
+void checkV2GTimeouts(void);
+void updateSpeculativeResponses(void);
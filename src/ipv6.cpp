@@ -1,6 +1,7 @@
 #include <Arduino.h>
 #include "main.h"
 #include "tcp.h"
+#include "recovery.h"
 #include <WebSerial.h>
 
 const uint8_t broadcastIPv6[16] = { 0xff, 0x02, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1};
@@ -247,7 +248,7 @@ void evaluateUdpPayload(void) {
     uint32_t v2gptPayloadLen;
     uint8_t i;
 
-    if (destinationport == 15118) { // port for the SECC
+    if (destinationport == 15118 && udpPayloadLen >= V2GTP_HEADER_SIZE) { // port for the SECC
       if ((udpPayload[0] == 0x01) && (udpPayload[1] == 0xFE)) { //# protocol version 1 and inverted
         // we are the charger, and it is a message from car to charger, lets save the cars IP and port for later use.
         memcpy(EvccIp, sourceIp, 16);
@@ -267,7 +268,7 @@ void evaluateUdpPayload(void) {
                               (((uint32_t)udpPayload[5])<<16) +
                               (((uint32_t)udpPayload[6])<<8) +
                               udpPayload[7];
-            if (v2gptPayloadLen == 2) {
+            if (v2gptPayloadLen == 2 && udpPayloadLen >= V2GTP_HEADER_SIZE + 2) {
                 //# 2 is the only valid length for a SDP request.
                 DiscoveryReqSecurity = udpPayload[8]; // normally 0x10 for "no transport layer security". Or 0x00 for "TLS".
                 DiscoveryReqTransportProtocol = udpPayload[9]; // normally 0x00 for TCP
@@ -275,6 +276,8 @@ void evaluateUdpPayload(void) {
                     WebSerial.printf("DiscoveryReqSecurity %u is not supported\n", DiscoveryReqSecurity);
                 } else if (DiscoveryReqTransportProtocol != 0x00) {
                     WebSerial.printf("DiscoveryReqTransportProtocol %u is not supported\n", DiscoveryReqTransportProtocol);
+                } else if (recoveryHolds(RECOVER_SDP)) {
+                    WebSerial.printf("SDP restart pending, no SDP response\n"); // the EV repeats its request
                 } else {
                     // This was a valid SDP request. Let's respond, if we are the charger.
                     WebSerial.printf("Ok, this was a valid SDP request. We are the SECC. Sending SDP response.\n");
@@ -381,13 +384,20 @@ void IPv6Manager(uint16_t rxbytes) {
     uint16_t nextheader; 
     uint8_t icmpv6type; 
 
-    WebSerial.printf("\n[RX] ");
-    for (x=0; x<rxbytes; x++) WebSerial.printf("%02x",rxbuffer[x]);
-    WebSerial.printf("\n");
+    if (!v2gHotPath) { // the hex dump takes longer than the whole CurrentDemand cycle
+        WebSerial.printf("\n[RX] ");
+        for (x=0; x<rxbytes; x++) WebSerial.printf("%02x",rxbuffer[x]);
+        WebSerial.printf("\n");
+    }
 
     //# The evaluation function for received ipv6 packages.
   
     if (rxbytes > 60) {
+        //# the IPv6 payload must be within the received frame. Frames are padded to 60 bytes, so it may be shorter, but never longer.
+        if (54 + (rxbuffer[18]*256 + rxbuffer[19]) > rxbytes) {
+            WebSerial.printf("Ignoring truncated IPv6 packet\n");
+            return;
+        }
         //# extract the source ipv6 address
         memcpy(sourceIp, rxbuffer+22, 16);
         nextheader = rxbuffer[20];
@@ -399,7 +409,7 @@ void IPv6Manager(uint16_t rxbytes) {
             udpsum = rxbuffer[60]*256 + rxbuffer[61];
 
             //# udplen is including 8 bytes header at the begin
-            if (udplen>UDP_PAYLOAD_LEN) {
+            if (udplen>UDP_PAYLOAD_LEN || 54 + udplen > rxbytes) {
                 /* ignore long UDP */
                 WebSerial.printf("Ignoring too long UDP\n");
                 return;
@@ -413,7 +423,7 @@ void IPv6Manager(uint16_t rxbytes) {
             }                      
         }
         if (nextheader == 0x06) { // # it is an TCP frame
-            WebSerial.printf("TCP received\n");
+            if (!v2gHotPath) WebSerial.printf("TCP received\n");
             evaluateTcpPacket();
         }
         if (nextheader == NEXT_ICMPv6) { // it is an ICMPv6 (NeighborSolicitation etc) frame
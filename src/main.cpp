@@ -46,6 +46,7 @@ const String FIRMWARE_VERSION = "v0.9";
 // Key for stored preferences
 const char* PREF_KEY = "secc_config"; 
 const char* URL_KEY = "soc_url";
+const char* REFRESH_KEY = "soc_refresh"; // minutes
 
 // Global variable to track the last time the 20ms logic was run
 unsigned long lastExecutionTime = 0;
@@ -58,6 +59,11 @@ bool shouldResetWifi = false;
 
 #include "main.h"
 #include "ipv6.h"
+#include "tcp.h"
+#include "soc.h"
+#include "recovery.h"
+#include "slac.h"
+#include "src/exi/projectExiConnector.h"
 
 // --- GLOBAL VARIABLES ---
 AsyncWebServer server(80);
@@ -67,18 +73,9 @@ uint8_t txbuffer[3164], rxbuffer[3164];
 uint8_t modem_state;
 uint8_t myMac[6]; // the MAC of the EVSE (derived from the ESP32's MAC).
 uint8_t pevMac[6]; // the MAC of the PEV.
-uint8_t myModemMac[6]; // our own modem's MAC (this is different from myMAC !). Unused.
-uint8_t pevModemMac[6]; // the MAC of the PEV's modem (obtained with GetSwReq). Could this be used to identify the EV?
-uint8_t pevRunId[8]; // pev RunId. Received from the PEV in the CM_SLAC_PARAM.REQ message.
-uint16_t AvgACVar[58]; // Average AC Variable Field. (used in CM_ATTEN_PROFILE.IND)
-uint8_t NMK[16]; // Network Key. Will be initialized with a random key on each session.
-uint8_t NID[] = {1, 2, 3, 4, 5, 6, 7}; // a default network ID. MSB bits 6 and 7 need to be 0.
-unsigned long SoundsTimer = 0;
-unsigned long ModemSearchTimer = 0;
-uint8_t ModemsFound = 0;
-uint8_t ReceivedSounds = 0;
 uint8_t EVCCID[6];  // Mac address or ID from the PEV, used in V2G communication
 uint8_t EVSOC = 0;  // State Of Charge of the EV, obtained from the 'ContractAuthenticationRequest' message
+unsigned long plugInTimer = 0; // millis() of the first CM_SLAC_PARAM.REQ, the first we see of a plugged in EV
 
 
 void SPI_InterruptHandler() { // Interrupt handler is currently unused
@@ -183,41 +180,12 @@ uint32_t qcaspi_read_burst(uint8_t *dst) {
     return 0;
 }
 
-void randomizeNmk() {
-    // randomize the Network Membership Key (NMK)
-    for (uint8_t i=0; i<16; i++) NMK[i] = random(256); // NMK 
-}
-
-void setNmkAt(uint16_t index) {
-    // sets the Network Membership Key (NMK) at a certain position in the transmit buffer
-    for (uint8_t i=0; i<16; i++) txbuffer[index+i] = NMK[i]; // NMK 
-}
-
-void setNidAt(uint16_t index) {
-    // copies the network ID (NID, 7 bytes) into the wished position in the transmit buffer
-    for (uint8_t i=0; i<7; i++) txbuffer[index+i] = NID[i];
-}
-
 void setMacAt(uint8_t *mac, uint16_t offset) {
     // at offset 0 in the ethernet frame, we have the destination MAC
     // at offset 6 in the ethernet frame, we have the source MAC
     for (uint8_t i=0; i<6; i++) txbuffer[offset+i]=mac[i];
 }
 
-void setRunId(uint16_t offset) {
-    // at the given offset in the transmit buffer, fill the 8-bytes-RunId.
-    for (uint8_t i=0; i<8; i++) txbuffer[offset+i]=pevRunId[i];
-}
-
-void setACVarField(uint16_t offset) {
-    for (uint8_t i=0; i<58; i++) txbuffer[offset+i]=AvgACVar[i];
-}    
-
-uint16_t getManagementMessageType() {
-    // calculates the MMTYPE (base value + lower two bits), see Table 11-2 of homeplug spec
-    return rxbuffer[16]*256 + rxbuffer[15];
-}
-
 uint16_t getFrameType() {
     // returns the Ethernet Frame type
     // 88E1 = HomeplugAV 
@@ -233,237 +201,8 @@ void ModemReset() {
     qcaspi_write_register(SPI_REG_SPI_CONFIG, reg16);
 }
 
-void composeSetKey() {
-    memset(txbuffer, 0x00, 60);  // clear buffer
-    txbuffer[0]=0x00; // Destination MAC
-    txbuffer[1]=0xB0;
-    txbuffer[2]=0x52;
-    txbuffer[3]=0x00;
-    txbuffer[4]=0x00;
-    txbuffer[5]=0x01;                
-    setMacAt(myMac, 6);  // Source MAC          
-    txbuffer[12]=0x88; // Protocol HomeplugAV
-    txbuffer[13]=0xE1;
-    txbuffer[14]=0x01; // version
-    txbuffer[15]=0x08; // CM_SET_KEY.REQ
-    txbuffer[16]=0x60; 
-    txbuffer[17]=0x00; // frag_index
-    txbuffer[18]=0x00; // frag_seqnum
-    txbuffer[19]=0x01; // 0 key info type
-    txbuffer[28]=0x04; // 9 nw info pid
-    txbuffer[29]=0x00; // 10 info prn
-    txbuffer[30]=0x00; // 11
-    txbuffer[31]=0x00; // 12 pmn
-    txbuffer[32]=0x00; // 13 CCo capability
-    setNidAt(33);    // 14-20 nid  7 bytes from 33 to 39
-    txbuffer[40]=0x01; // NewEKS. Table A.8 01 is NMK.
-    setNmkAt(41); 
-}
-
-void composeGetSwReq() {
-    // GET_SW.REQ request
-    memset(txbuffer, 0x00, 60);  // clear buffer
-    txbuffer[0]=0xff;  // Destination MAC Broadcast
-    txbuffer[1]=0xff;
-    txbuffer[2]=0xff;
-    txbuffer[3]=0xff;
-    txbuffer[4]=0xff;
-    txbuffer[5]=0xff;                
-    setMacAt(myMac, 6);  // Source MAC          
-    txbuffer[12]=0x88; // Protocol HomeplugAV
-    txbuffer[13]=0xE1;
-    txbuffer[14]=0x00; // version
-    txbuffer[15]=0x00; // GET_SW.REQ
-    txbuffer[16]=0xA0;  
-    txbuffer[17]=0x00; // Vendor OUI
-    txbuffer[18]=0xB0;  
-    txbuffer[19]=0x52;  
-}
-
-void composeSlacParamCnf() {
-
-    memset(txbuffer, 0x00, 60);  // clear txbuffer
-    setMacAt(pevMac, 0);  // Destination MAC
-    setMacAt(myMac, 6);  // Source MAC
-    txbuffer[12]=0x88; // Protocol HomeplugAV
-    txbuffer[13]=0xE1;
-    txbuffer[14]=0x01; // version
-    txbuffer[15]=0x65; // SLAC_PARAM.CNF
-    txbuffer[16]=0x60; // 
-    txbuffer[17]=0x00; // 2 bytes fragmentation information. 0000 means: unfragmented.
-    txbuffer[18]=0x00; // 
-    txbuffer[19]=0xff; // 19-24 sound target
-    txbuffer[20]=0xff; 
-    txbuffer[21]=0xff; 
-    txbuffer[22]=0xff; 
-    txbuffer[23]=0xff; 
-    txbuffer[24]=0xff; 
-    txbuffer[25]=0x0A; // sound count
-    txbuffer[26]=0x06; // timeout
-    txbuffer[27]=0x01; // resptype
-    setMacAt(pevMac, 28);  // forwarding_sta, same as PEV MAC, plus 2 bytes 00 00
-    txbuffer[34]=0x00; // 
-    txbuffer[35]=0x00; // 
-    setRunId(36);  // 36 to 43 runid 8 bytes 
-    // rest is 00
-}
-
- void composeAttenCharInd() {
-    
-    memset(txbuffer, 0x00, 130);  // clear txbuffer
-    setMacAt(pevMac, 0);  // Destination MAC
-    setMacAt(myMac, 6);  // Source MAC
-    txbuffer[12]=0x88; // Protocol HomeplugAV
-    txbuffer[13]=0xE1;
-    txbuffer[14]=0x01; // version
-    txbuffer[15]=0x6E; // ATTEN_CHAR.IND
-    txbuffer[16]=0x60;  
-    txbuffer[17]=0x00; // 2 bytes fragmentation information. 0000 means: unfragmented.
-    txbuffer[18]=0x00; // 
-    txbuffer[19]=0x00; // apptype
-    txbuffer[20]=0x00; // security
-    setMacAt(pevMac, 21); // Mac address of the EV Host which initiates the SLAC process
-    setRunId(27); // RunId 8 bytes 
-    txbuffer[35]=0x00; // 35 - 51 source_id, 17 bytes 0x00 (defined in ISO15118-3 table A.4)
-        
-    txbuffer[52]=0x00; // 52 - 68 response_id, 17 bytes 0x00. (defined in ISO15118-3 table A.4)
-    
-    txbuffer[69]=ReceivedSounds; // Number of sounds. 10 in normal case. 
-    txbuffer[70]=0x3A; // Number of groups = 58. (defined in ISO15118-3 table A.4)
-    setACVarField(71); // 71 to 128: The group attenuation for the 58 announced groups.
- }
-
-
-void composeSlacMatchCnf() {
-    
-    memset(txbuffer, 0x00, 109);  // clear txbuffer
-    setMacAt(pevMac, 0);  // Destination MAC
-    setMacAt(myMac, 6);  // Source MAC
-    txbuffer[12]=0x88; // Protocol HomeplugAV
-    txbuffer[13]=0xE1;
-    txbuffer[14]=0x01; // version
-    txbuffer[15]=0x7D; // SLAC_MATCH.CNF
-    txbuffer[16]=0x60; // 
-    txbuffer[17]=0x00; // 2 bytes fragmentation information. 0000 means: unfragmented.
-    txbuffer[18]=0x00; // 
-    txbuffer[19]=0x00; // apptype
-    txbuffer[20]=0x00; // security
-    txbuffer[21]=0x56; // length 2 byte
-    txbuffer[22]=0x00;  
-                          // 23 - 39: pev_id 17 bytes. All zero.
-    setMacAt(pevMac, 40); // Pev Mac address
-                          // 46 - 62: evse_id 17 bytes. All zero.
-    setMacAt(myMac, 63);  // 63 - 68 evse_mac 
-    setRunId(69);         // runid 8 bytes 69-76 run_id.
-                          // 77 to 84 reserved 0
-    setNidAt(85);         // 85-91 NID. We can nearly freely choose this, but the upper two bits need to be zero
-                          // 92 reserved 0                                  
-    setNmkAt(93);         // 93 to 108 NMK. We can freely choose this. Normally we should use a random number. 
-}        
-
-void composeFactoryDefaults() {
-
-    memset(txbuffer, 0x00, 60);  // clear buffer
-    txbuffer[0]=0x00; // Destination MAC
-    txbuffer[1]=0xB0;
-    txbuffer[2]=0x52;
-    txbuffer[3]=0x00;
-    txbuffer[4]=0x00;
-    txbuffer[5]=0x01;                
-    setMacAt(myMac, 6); // Source MAC          
-    txbuffer[12]=0x88; // Protocol HomeplugAV
-    txbuffer[13]=0xE1;
-    txbuffer[14]=0x00; // version
-    txbuffer[15]=0x7C; // Load modem Factory Defaults (same as holding GPIO3 low for 15 secs)
-    txbuffer[16]=0xA0; 
-    txbuffer[17]=0x00; 
-    txbuffer[18]=0xB0; 
-    txbuffer[19]=0x52; 
-}
-
-// Received SLAC messages from the PEV are handled here
-void SlacManager(uint16_t rxbytes) {
-    uint16_t reg16, mnt, x;
-
-    mnt = getManagementMessageType();
-  
-  //  Serial.print("[RX] ");
-  //  for (x=0; x<rxbytes; x++) WebSerial.printf("%02x ",rxbuffer[x]);
-  //  WebSerial.printf("\n");
-
-    if (mnt == (CM_SET_KEY + MMTYPE_CNF)) {
-        WebSerial.printf("received SET_KEY.CNF\n");
-        if (rxbuffer[19] == 0x01) {
-            modem_state = MODEM_CONFIGURED;
-            // copy MAC from the EVSE modem to myModemMac. This MAC is not used for communication.
-            memcpy(myModemMac, rxbuffer+6, 6);
-            WebSerial.printf("NMK set\n");
-        } else WebSerial.printf("NMK -NOT- set\n");
-
-    } else if (mnt == (CM_SLAC_PARAM + MMTYPE_REQ)) {
-        WebSerial.printf("received CM_SLAC_PARAM.REQ\n");
-        // We received a SLAC_PARAM request from the PEV. This is the initiation of a SLAC procedure.
-        // We extract the pev MAC from it.
-        memcpy(pevMac, rxbuffer+6, 6);
-        // extract the RunId from the SlacParamReq, and store it for later use
-        memcpy(pevRunId, rxbuffer+21, 8);
-        // We are EVSE, we want to answer.
-        composeSlacParamCnf();
-        qcaspi_write_burst(txbuffer, 60); // Send data to modem
-        modem_state = SLAC_PARAM_CNF;
-        WebSerial.printf("transmitting CM_SLAC_PARAM.CNF\n");
-
-    } else if (mnt == (CM_START_ATTEN_CHAR + MMTYPE_IND) && modem_state == SLAC_PARAM_CNF) {
-        WebSerial.printf("received CM_START_ATTEN_CHAR.IND\n");
-        SoundsTimer = millis(); // start timer
-        memset(AvgACVar, 0x00, 58); // reset averages.
-        ReceivedSounds = 0;
-        modem_state = MNBC_SOUND;
-
-    } else if (mnt == (CM_MNBC_SOUND + MMTYPE_IND) && modem_state == MNBC_SOUND) { 
-        WebSerial.printf("received CM_MNBC_SOUND.IND\n");
-        ReceivedSounds++;
-
-    } else if (mnt == (CM_ATTEN_PROFILE + MMTYPE_IND) && modem_state == MNBC_SOUND) { 
-        WebSerial.printf("received CM_ATTEN_PROFILE.IND\n");
-        for (x=0; x<58; x++) AvgACVar[x] += rxbuffer[27+x];
-      
-        if (ReceivedSounds == 10) {
-            WebSerial.printf("Start Average Calculation\n");
-            for (x=0; x<58; x++) AvgACVar[x] = AvgACVar[x] / ReceivedSounds;
-        }  
-
-    } else if (mnt == (CM_ATTEN_CHAR + MMTYPE_RSP) && modem_state == ATTEN_CHAR_IND) { 
-        WebSerial.printf("received CM_ATTEN_CHAR.RSP\n");
-        // verify pevMac, RunID, and succesful Slac fields
-        if (memcmp(pevMac, rxbuffer+21, 6) == 0 && memcmp(pevRunId, rxbuffer+27, 8) == 0 && rxbuffer[69] == 0) {
-            WebSerial.printf("Successful SLAC process\n");
-            modem_state = ATTEN_CHAR_RSP;
-        } else modem_state = MODEM_CONFIGURED; // probably not correct, should ignore data, and retransmit CM_ATTEN_CHAR.IND
-
-    } else if (mnt == (CM_SLAC_MATCH + MMTYPE_REQ) && modem_state == ATTEN_CHAR_RSP) { 
-        WebSerial.printf("received CM_SLAC_MATCH.REQ\n"); 
-        // Verify pevMac, RunID and MVFLength fields
-        if (memcmp(pevMac, rxbuffer+40, 6) == 0 && memcmp(pevRunId, rxbuffer+69, 8) == 0 && rxbuffer[21] == 0x3e) {
-            composeSlacMatchCnf();
-            qcaspi_write_burst(txbuffer, 109); // Send data to modem
-            WebSerial.printf("transmitting CM_SLAC_MATCH.CNF\n");
-            modem_state = MODEM_GET_SW_REQ;
-        }
-
-    } else if (mnt == (CM_GET_SW + MMTYPE_CNF) && modem_state == MODEM_WAIT_SW) { 
-        // Both the local and Pev modem will send their software version.
-        // check if the MAC of the modem is the same as our local modem.
-        if (memcmp(rxbuffer+6, myModemMac, 6) != 0) { 
-            // Store the Pev modem MAC, as long as it is not random, we can use it for identifying the EV (Autocharge / Plug N Charge)
-            memcpy(pevModemMac, rxbuffer+6, 6);
-        }
-        WebSerial.printf("received GET_SW.CNF\n");
-        ModemsFound++;
-    }
-}
-
-void sendSocCallback(float current_soc, float full_soc, float energy_capacity, float energy_request, const String& evccid) {
+// confidence is 100 for a SoC the EV reported, less for an estimate, see soc.cpp
+void sendSocCallback(float current_soc, float full_soc, float energy_capacity, float energy_request, const String& evccid, uint8_t confidence) {
     if (WiFi.status() != WL_CONNECTED || soc_callback_url.length() == 0) {
         WebSerial.println("WiFi not connected or Callback URL not set. Skipping SOC callback.");
         return;
@@ -474,6 +213,7 @@ void sendSocCallback(float current_soc, float full_soc, float energy_capacity, f
     query += "&energy_capacity=" + String(energy_capacity, 1);
     query += "&energy_request=" + String(energy_request, 1);
     query += "&evccid=" + evccid;
+    query += "&soc_confidence=" + String(confidence);
 
     // Combine the base URL and the query string
     String fullUrl = soc_callback_url + query;
@@ -503,7 +243,7 @@ void sendSocCallback(float current_soc, float full_soc, float energy_capacity, f
 //
 void Timer20ms(void * parameter) {
 
-    uint16_t reg16, rxbytes, mnt, x;
+    uint16_t reg16, rxbytes, mnt;
     uint16_t FrameType;
     
     while(1)  // infinite loop
@@ -532,6 +272,7 @@ void Timer20ms(void * parameter) {
                 composeSetKey();      // set up buffer with CM_SET_KEY.REQ request data
                 qcaspi_write_burst(txbuffer, 60);    // write minimal 60 bytes according to an4_rev5.pdf
                 WebSerial.printf("transmitting SET_KEY.REQ, to configure the EVSE modem with random NMK\n"); 
+                SetKeyTimer = millis();
                 modem_state = MODEM_CM_SET_KEY_CNF;
                 break;
 
@@ -545,6 +286,7 @@ void Timer20ms(void * parameter) {
                 break;
 
             default:
+                if (recoveryHolds(RECOVER_SPI)) break; // after an invalid frame, the modem keeps the next ones
                 // poll modem for data
                 reg16 = qcaspi_read_burst(rxbuffer);
 
@@ -552,10 +294,11 @@ void Timer20ms(void * parameter) {
                     // we received data, read the length of the first packet.
                     rxbytes = rxbuffer[8] + (rxbuffer[9] << 8);
                     
-                    // check if the header exists and a minimum of 60 bytes are available
-                    if (rxbuffer[4] == 0xaa && rxbuffer[5] == 0xaa && rxbuffer[6] == 0xaa && rxbuffer[7] == 0xaa && rxbytes >= 60) {
+                    // check if the header exists, a minimum of 60 bytes are available, and the whole packet
+                    // (12 bytes header, 2 bytes footer) is in the buffer. The managers below only look at the first rxbytes.
+                    if (rxbuffer[4] == 0xaa && rxbuffer[5] == 0xaa && rxbuffer[6] == 0xaa && rxbuffer[7] == 0xaa && rxbytes >= 60 && rxbytes + 14 <= reg16) {
                         // now remove the header, and footer.
-                        memcpy(rxbuffer, rxbuffer+12, reg16-14);
+                        memmove(rxbuffer, rxbuffer+12, reg16-14);
                         //WebSerial.printf("available: %u rxbuffer bytes: %u\n",reg16, rxbytes);
                     
                         FrameType = getFrameType();
@@ -566,66 +309,59 @@ void Timer20ms(void * parameter) {
                         if ((int16_t)reg16-rxbytes-14 >= 74) {
                             reg16 = reg16-rxbytes-14;
                             // move data forward.
-                            memcpy(rxbuffer, rxbuffer+2+rxbytes, reg16);
+                            memmove(rxbuffer, rxbuffer+2+rxbytes, reg16);
                         } else reg16 = 0;
                       
                     } else {
                         WebSerial.printf("Invalid data!\n");
-                        ModemReset();
-                        modem_state = MODEM_POWERUP;
+                        reg16 = 0; // drop the rest of the burst, the next one starts with a frame
+                        recoverFrom(RECOVER_SPI, "invalid SPI frame");
                     }  
                 }
                 break;
         }
 
-        // Did the Sound timer expire?
-        if (modem_state == MNBC_SOUND && (SoundsTimer + 600) < millis() ) {
-            WebSerial.printf("SOUND timer expired\n");
-            // Send CM_ATTEN_CHAR_IND, even if no Sounds were received.
-            composeAttenCharInd();
-            qcaspi_write_burst(txbuffer, 129); // Send data to modem
-            modem_state = ATTEN_CHAR_IND;
-            WebSerial.printf("transmitting CM_ATTEN_CHAR.IND\n");
+        checkSlacTimeouts(); // repeats a lost SLAC message, or gives up the run
+
+        // Did the Modem Search timer expire? Then a GET_SW.CNF got lost.
+        if (modem_state == MODEM_WAIT_SW && millis() - ModemSearchTimer > MODEM_SEARCH_TIMEOUT_MS) {
+            WebSerial.printf("MODEM timer expired. Found %u modems, (re)transmitting MODEM_GET_SW.REQ\n", ModemsFound);
+            // Restart modem search
+            modem_state = MODEM_GET_SW_REQ;
+        }
+
+        // Did the modem not confirm the new NMK?
+        if (modem_state == MODEM_CM_SET_KEY_CNF && millis() - SetKeyTimer > SET_KEY_TIMEOUT_MS) {
+            if (++SetKeyRetries > SET_KEY_RETRIES) {
+                SetKeyRetries = 0;
+                recoverFrom(RECOVER_MODEM, "no SET_KEY.CNF");
+            } else modem_state = MODEM_CM_SET_KEY_REQ;
         }
 
-        // Did the Modem Search timer expire?
-        if (modem_state == MODEM_WAIT_SW && (ModemSearchTimer + 1000) < millis() ) {
-            WebSerial.printf("MODEM timer expired. ");
-            if (ModemsFound >= 2) {
-                WebSerial.printf("Found %u modems. Private network between EVSE and PEV established\n", ModemsFound); 
-                
-                WebSerial.printf("PEV MAC: ");
-                for(x=0; x<6 ;x++) WebSerial.printf("%02x", pevMac[x]);
-                WebSerial.printf(" PEV modem MAC: ");
-                for(x=0; x<6 ;x++) WebSerial.printf("%02x", pevModemMac[x]);
-                WebSerial.printf("\n");
-
-                modem_state = MODEM_LINK_READY;
-
-                WebSerial.println("Initial SOC Callback triggered.");
-
-                String evccid_str = macArrayToString(pevMac);
-                
-                sendSocCallback(
-                    (float)EVSOC,        
-                    0.0,                  
-                    0.0,                  
-                    0.0,                  
-                    evccid_str            
-                );
-                
-                // Transition to next V2G state (important to prevent repeated calls)
-                modem_state = MODEM_V2G_INIT; 
-            } else {
-                WebSerial.printf("(re)transmitting MODEM_GET_SW.REQ\n");
-                // Restart modem search
-                modem_state = MODEM_GET_SW_REQ;
-            } 
+        // Is the EV still in our AVLN, while it charges without a session? Both modems answer the GET_SW.REQ.
+        if (modem_state == MODEM_V2G_INIT && !v2gSessionRunning() && millis() - LinkCheckTimer > LINK_CHECK_INTERVAL_MS) {
+            composeGetSwReq();
+            qcaspi_write_burst(txbuffer, 60);
+            ModemsFound = 0;
+            LinkCheckTimer = millis();
+            modem_state = MODEM_LINK_CHECK;
+        }
+        if (modem_state == MODEM_LINK_CHECK && millis() - LinkCheckTimer > 1000) {
+            LinkCheckTimer = millis();
+            modem_state = MODEM_V2G_INIT;
+            if (ModemsFound < 2) {
+                socEstimate_reset(); // unplugged
+                rearmModem("link to the EV lost");
+            }
         }
 
+        recovery_poll(); // restarts a failed layer after its backoff
+        checkV2GTimeouts(); // ends a V2G session whose EV stopped talking
+        updateSpeculativeResponses(); // encodes the next CurrentDemandRes while we wait for the request
+        socRefresh_poll(); // asks for a new session when the SoC is due again
 
-        // Pause the task for 20ms (NOTE: The function name suggests 20ms, the original code had 2000ms. Corrected to 20ms for potential SLAC timing accuracy.)
-        vTaskDelay(2000 / portTICK_PERIOD_MS);
+        // Pause the task for 20ms. While the EV charges, poll faster: the CurrentDemandReq waits in the modem until we look.
+        vTaskDelay((v2gHotPath ? TIMER_POLL_FAST_MS : TIMER_POLL_MS) / portTICK_PERIOD_MS);
 
     } // while(1)
 }  
@@ -662,6 +398,7 @@ void wifi_setup_manager() {
 void loadConfiguration() {
     preferences.begin(PREF_KEY, false);
     soc_callback_url = preferences.getString(URL_KEY, "");
+    socRefreshInterval = preferences.getUInt(REFRESH_KEY, SOC_REFRESH_INTERVAL_MS / 60000) * 60000UL;
     preferences.end();
 
     if (soc_callback_url.length() > 0) {
@@ -669,6 +406,7 @@ void loadConfiguration() {
     } else {
         WebSerial.println("No SOC Callback URL configured yet.");
     }
+    WebSerial.printf("SoC refresh every %lu minutes\n", (unsigned long)(socRefreshInterval / 60000));
 }
 
 
@@ -680,6 +418,14 @@ void saveConfiguration(const String& url) {
     WebSerial.printf("New SOC Callback URL saved: %s\n", soc_callback_url.c_str());
 }
 
+void saveRefreshInterval(uint32_t minutes) {
+    preferences.begin(PREF_KEY, false);
+    preferences.putUInt(REFRESH_KEY, minutes);
+    preferences.end();
+    socRefreshInterval = minutes * 60000UL;
+    WebSerial.printf("New SoC refresh interval saved: %lu minutes\n", (unsigned long)minutes);
+}
+
 void handleConfigPage(AsyncWebServerRequest *request) {
     String html = "<!DOCTYPE html><html><head><title>EVSE Config</title>";
     html += "<meta name=\"viewport\" content=\"width=device-width, initial-scale=1\">";
@@ -693,6 +439,8 @@ void handleConfigPage(AsyncWebServerRequest *request) {
     html += "<form method='POST' action='/save'>";
     html += "Callback URL (SmartEVSE):<br>";
     html += "<input type='text' name='url' value='" + soc_callback_url + "' placeholder='e.g., http://192.168.1.100/ev_state'><br>";
+    html += "SoC refresh while charging on AC, minutes (0 = off). Adapts to the charging speed:<br>";
+    html += "<input type='text' name='refresh' value='" + String(socRefreshInterval / 60000) + "'><br>";
     html += "<button type='submit'>Save Configuration</button>";
     html += "</form>";
     
@@ -721,6 +469,11 @@ void setup() {
     Serial.begin(115200);
     while(!Serial) { delay(10); }
     Serial.printf("\npowerup\n");
+    Serial.printf("EXI documents: dinEXIDocument %u bytes, appHandEXIDocument %u bytes, shared arena %u of %u bytes budget, saves %u bytes\n",
+                  sizeof(struct dinEXIDocument), sizeof(struct appHandEXIDocument), EXI_DOCUMENT_RAM, EXI_DOCUMENT_RAM_BUDGET,
+                  EXI_DOCUMENT_RAM_SEPARATE - EXI_DOCUMENT_RAM);
+    projectExiConnector_buildResponseTemplates(); // encode the constant V2G responses once
+    buildV2GDispatchTable();
 
     wifi_setup_manager();
 
@@ -733,6 +486,7 @@ void setup() {
                 if (request->hasArg("url")) {
                     String newUrl = request->arg("url");
                     saveConfiguration(newUrl); // Function that saves the URL
+                    if (request->hasArg("refresh") && request->arg("refresh").toInt() >= 0) saveRefreshInterval(request->arg("refresh").toInt());
                     request->redirect("/config"); // Redirect
                 } else {
                     request->send(400, "text/plain", "Missing 'url' parameter.");
@@ -750,6 +504,16 @@ void setup() {
         shouldResetWifi = true;
     });
 
+    // the SmartEVSE pushes the power it delivers, for the SoC estimate
+    server.on("/api/power", HTTP_POST, [](AsyncWebServerRequest *request) {
+        if (request->hasArg("power")) {
+            socEstimate_pushPower(request->arg("power").toFloat()); // W
+            request->send(200, "text/plain", "OK");
+        } else {
+            request->send(400, "text/plain", "Missing 'power' parameter.");
+        }
+    });
+
     server.on("/api/reboot", HTTP_POST, [](AsyncWebServerRequest *request) {
         request->send(200, "text/plain", "Reboot initiated.");
         delay(100); 
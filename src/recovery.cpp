@@ -0,0 +1,121 @@
+#include <Arduino.h>
+#include "main.h"
+#include "ipv6.h"
+#include "tcp.h"
+#include "recovery.h"
+#include <WebSerial.h>
+
+/* Failures are recovered from the layer they hit, not with a modem reset. A dropped TCP connection only costs
+   the V2G session, the EV stays in our AVLN and connects again. Each layer has a budget of failures, close
+   together in time. A layer which fails more often is restarted from the layer below it, after a backoff. */
+
+#define RECOVERY_NONE 0xFF
+
+struct recoveryLayer {
+    const char *name;
+    uint8_t budget;     // failures within RECOVERY_WINDOW_MS, before the layer below is restarted
+    uint16_t backoffMs; // before the restart, doubles with each further failure
+};
+
+const struct recoveryLayer recoveryLayers[RECOVER_LAYERS] = {
+    { "SPI", 5, 100 },     // the bytes are dropped, the modem is read again after the backoff
+    { "modem", 0, 1000 },  // nothing below, retried with the backoff only
+    { "SLAC", 3, 250 },    // the EV repeats its CM_SLAC_PARAM.REQ
+    { "SDP", 2, 250 },     // the EV repeats its SDP request every 250 ms
+    { "TCP", 3, 100 },     // the EV repeats its SYN
+    { "V2G", 3, 100 },
+};
+
+uint8_t recoveryFailures[RECOVER_LAYERS];
+unsigned long recoveryLastFailure[RECOVER_LAYERS];
+uint8_t recoveryPending = RECOVERY_NONE; // layer of the restart which waits for its backoff
+const char *recoveryReason;
+unsigned long recoveryTimer;
+uint32_t recoveryDelay;
+unsigned long spiHoldTimer; // the SPI layer has no restart, the modem is not read until its backoff is over
+uint32_t spiHoldDelay;
+
+uint32_t backoffFor(uint8_t layer) {
+    uint32_t ms = (uint32_t)recoveryLayers[layer].backoffMs << (recoveryFailures[layer] - 1);
+
+    return ms > RECOVERY_BACKOFF_MAX_MS ? RECOVERY_BACKOFF_MAX_MS : ms;
+}
+
+uint8_t layerBelow(uint8_t layer) {
+    if (layer == RECOVER_SPI) return RECOVER_MODEM; // the SPI link is only as good as the modem behind it
+    return layer - 1;
+}
+
+void restartLayer(uint8_t layer, const char *reason) {
+    WebSerial.printf("[Recovery] restarting from %s: %s\n", recoveryLayers[layer].name, reason);
+    switch (layer) {
+    case RECOVER_MODEM:
+        rearmModem(reason); // forgets the EV
+        ModemReset();
+        modem_state = MODEM_POWERUP;
+        break;
+    case RECOVER_SLAC:
+        if (modem_state >= MODEM_GET_SW_REQ) rearmModem(reason); // a new NMK, the EV has to match again
+        // else the failed run is over already, we wait for the next CM_SLAC_PARAM.REQ of the EV
+        break;
+    case RECOVER_SDP:
+        memset(EvccIp, 0, 16); // the next SDP request tells us again
+        evccTcpPort = 0;
+        break;
+    default:
+        break; // TCP and V2G: the session is closed already, the EV connects again
+    }
+}
+
+void recoverFrom(uint8_t layer, const char *reason) {
+    unsigned long now = millis();
+
+    if (now - recoveryLastFailure[layer] > RECOVERY_WINDOW_MS) recoveryFailures[layer] = 0;
+    recoveryLastFailure[layer] = now;
+    while (++recoveryFailures[layer] > recoveryLayers[layer].budget && layer != RECOVER_MODEM) {
+        WebSerial.printf("[Recovery] %s failed %u times, escalating\n", recoveryLayers[layer].name, recoveryFailures[layer]);
+        recoveryFailures[layer] = 0;
+        layer = layerBelow(layer);
+        if (now - recoveryLastFailure[layer] > RECOVERY_WINDOW_MS) recoveryFailures[layer] = 0;
+        recoveryLastFailure[layer] = now;
+    }
+    if (recoveryFailures[layer] > RECOVERY_BACKOFF_STEPS) recoveryFailures[layer] = RECOVERY_BACKOFF_STEPS; // the modem has no budget
+    WebSerial.printf("[Recovery] %s failure %u: %s\n", recoveryLayers[layer].name, recoveryFailures[layer], reason);
+    if (layer == RECOVER_SPI) { // the caller dropped the bytes already, the session goes on
+        spiHoldTimer = now;
+        spiHoldDelay = backoffFor(layer);
+        return;
+    }
+
+    // Whatever restarts, the V2G session on top of it is lost. Close it now, not after the backoff.
+    if (v2gSessionRunning()) resetV2GSession(reason);
+
+    // one restart at a time, the lowest layer wins
+    if (recoveryPending != RECOVERY_NONE && recoveryPending <= layer) return;
+    recoveryPending = layer;
+    recoveryReason = reason;
+    recoveryTimer = now;
+    recoveryDelay = backoffFor(layer);
+    recovery_poll();
+}
+
+/* A session went all the way through. */
+void recoverySucceeded(void) {
+    memset(recoveryFailures, 0, sizeof(recoveryFailures));
+}
+
+/* True while a restart of this layer, or of one below it, waits for its backoff. Until then the layer is
+   not started again. The EV repeats its request until it is. */
+bool recoveryHolds(uint8_t layer) {
+    if (layer == RECOVER_SPI) return millis() - spiHoldTimer < spiHoldDelay;
+    return recoveryPending != RECOVERY_NONE && recoveryPending <= layer;
+}
+
+/* Called by the Timer20ms task, runs the restart when its backoff is over. */
+void recovery_poll(void) {
+    uint8_t layer = recoveryPending;
+
+    if (layer == RECOVERY_NONE || millis() - recoveryTimer < recoveryDelay) return;
+    recoveryPending = RECOVERY_NONE;
+    restartLayer(layer, recoveryReason);
+}
@@ -0,0 +1,606 @@
+// SLAC (ISO 15118-3) and the HomePlug messages to our modem: matching the EV, giving the modem its NMK,
+// and finding both modems in the AVLN. SlacManager() gets the HomePlug frames the Timer20ms task receives.
+
+#include <Arduino.h>
+#include "main.h"
+#include "tcp.h"
+#include "soc.h"
+#include "slac.h"
+#include "recovery.h"
+#include <WebSerial.h>
+
+uint8_t myModemMac[6]; // our own modem's MAC (this is different from myMAC !). Unused.
+uint8_t pevModemMac[6]; // the MAC of the PEV's modem (obtained with GetSwReq). Could this be used to identify the EV?
+uint8_t pevRunId[8]; // pev RunId of the matched EV. Received from the PEV in the CM_SLAC_PARAM.REQ message.
+uint8_t NMK[16]; // Network Key. Will be initialized with a random key on each session.
+uint8_t NID[] = {1, 2, 3, 4, 5, 6, 7}; // a default network ID. MSB bits 6 and 7 need to be 0.
+unsigned long SlacTimer = 0;     // millis() when the modem search after the match began
+uint8_t SlacAttempts = 0;       // SLAC runs of the matched EV for this plug-in
+unsigned long ModemSearchTimer = 0;
+unsigned long SetKeyTimer = 0;
+uint8_t SetKeyRetries = 0;
+unsigned long LinkCheckTimer = 0;
+unsigned long RearmTimer = 0;   // millis() of the last teardown
+uint8_t Rearming = 0;           // 1 from the teardown until the modem has its new NMK
+uint32_t RearmCount = 0, RearmMaxMs = 0;
+uint8_t ModemsFound = 0;
+struct socTiming plugInToLink;  // plug-in to the private network with the EV
+
+// An EV which runs the SLAC with us. On a shared cable, or through crosstalk, we also hear the SLAC of EVs
+// at other chargers. Each run gets a slot of its own. The EV picks the charger it hears best, and the first EV
+// which sends us its CM_SLAC_MATCH.REQ is matched.
+#define SLAC_FREE 0
+struct slacCandidate {
+    uint8_t state;            // SLAC_PARAM_CNF .. ATTEN_CHAR_RSP, or SLAC_FREE
+    uint8_t mac[6];           // kept in a free slot, for the attempts of the EV
+    uint8_t runId[8];
+    unsigned long timer;      // millis() when the step began
+    unsigned long plugIn;     // millis() of the first CM_SLAC_PARAM.REQ of this plug-in
+    uint8_t attempts;         // runs of this plug-in, the EV starts a new one when a run fails
+    uint8_t retries;          // repeats of our last message in this step
+    uint8_t expectedSounds, receivedSounds;
+    uint8_t receivedProfiles; // CM_ATTEN_PROFILE.IND, one from our modem for each sound it heard
+    uint16_t avgACVar[58];    // Average AC Variable Field, sums until the sounding is done
+    uint16_t attenuation;     // dB, average over the groups, once the sounding is done
+};
+
+struct slacCandidate slacCandidates[SLAC_CANDIDATES];
+
+// The SLAC steps in which we wait for the EV, with the ISO 15118-3 timer of each, see checkSlacTimeouts().
+// The time a step took is kept, to see how close a car comes to the timers.
+struct slacStep {
+    uint8_t state;        // of the candidate, or modem_state while we wait
+    const char *waitsFor;
+    uint16_t timeoutMs;
+    uint32_t lastMs, maxMs;
+};
+
+struct slacStep slacSteps[] = {
+    { SLAC_PARAM_CNF, "CM_START_ATTEN_CHAR.IND", TT_MATCH_SEQUENCE_MS, 0, 0 },
+    { MNBC_SOUND, "sounds", TT_EVSE_MATCH_MNBC_MS, 0, 0 },
+    { ATTEN_CHAR_IND, "CM_ATTEN_CHAR.RSP", TT_MATCH_RESPONSE_MS, 0, 0 },
+    { ATTEN_CHAR_RSP, "CM_SLAC_MATCH.REQ", TT_EVSE_MATCH_SESSION_MS, 0, 0 },
+    { MODEM_WAIT_SW, "GET_SW.CNF of both modems", TT_MATCH_JOIN_MS, 0, 0 }, // also MODEM_GET_SW_REQ, the search is repeated
+};
+#define SLAC_STEPS (sizeof(slacSteps) / sizeof(slacSteps[0]))
+
+void randomizeNmk() {
+    // randomize the Network Membership Key (NMK)
+    for (uint8_t i=0; i<16; i++) NMK[i] = random(256); // NMK 
+}
+
+void setNmkAt(uint16_t index) {
+    // sets the Network Membership Key (NMK) at a certain position in the transmit buffer
+    for (uint8_t i=0; i<16; i++) txbuffer[index+i] = NMK[i]; // NMK 
+}
+
+void setNidAt(uint16_t index) {
+    // copies the network ID (NID, 7 bytes) into the wished position in the transmit buffer
+    for (uint8_t i=0; i<7; i++) txbuffer[index+i] = NID[i];
+}
+
+void setRunIdAt(uint8_t *runId, uint16_t offset) {
+    // at the given offset in the transmit buffer, fill the 8-bytes-RunId.
+    for (uint8_t i=0; i<8; i++) txbuffer[offset+i]=runId[i];
+}
+
+void setACVarField(uint16_t *avgACVar, uint16_t offset) {
+    for (uint8_t i=0; i<58; i++) txbuffer[offset+i]=avgACVar[i];
+}    
+
+uint16_t getManagementMessageType() {
+    // calculates the MMTYPE (base value + lower two bits), see Table 11-2 of homeplug spec
+    return rxbuffer[16]*256 + rxbuffer[15];
+}
+
+void composeSetKey() {
+    memset(txbuffer, 0x00, 60);  // clear buffer
+    txbuffer[0]=0x00; // Destination MAC
+    txbuffer[1]=0xB0;
+    txbuffer[2]=0x52;
+    txbuffer[3]=0x00;
+    txbuffer[4]=0x00;
+    txbuffer[5]=0x01;                
+    setMacAt(myMac, 6);  // Source MAC          
+    txbuffer[12]=0x88; // Protocol HomeplugAV
+    txbuffer[13]=0xE1;
+    txbuffer[14]=0x01; // version
+    txbuffer[15]=0x08; // CM_SET_KEY.REQ
+    txbuffer[16]=0x60; 
+    txbuffer[17]=0x00; // frag_index
+    txbuffer[18]=0x00; // frag_seqnum
+    txbuffer[19]=0x01; // 0 key info type
+    txbuffer[28]=0x04; // 9 nw info pid
+    txbuffer[29]=0x00; // 10 info prn
+    txbuffer[30]=0x00; // 11
+    txbuffer[31]=0x00; // 12 pmn
+    txbuffer[32]=0x00; // 13 CCo capability
+    setNidAt(33);    // 14-20 nid  7 bytes from 33 to 39
+    txbuffer[40]=0x01; // NewEKS. Table A.8 01 is NMK.
+    setNmkAt(41); 
+}
+
+void composeGetSwReq() {
+    // GET_SW.REQ request
+    memset(txbuffer, 0x00, 60);  // clear buffer
+    txbuffer[0]=0xff;  // Destination MAC Broadcast
+    txbuffer[1]=0xff;
+    txbuffer[2]=0xff;
+    txbuffer[3]=0xff;
+    txbuffer[4]=0xff;
+    txbuffer[5]=0xff;                
+    setMacAt(myMac, 6);  // Source MAC          
+    txbuffer[12]=0x88; // Protocol HomeplugAV
+    txbuffer[13]=0xE1;
+    txbuffer[14]=0x00; // version
+    txbuffer[15]=0x00; // GET_SW.REQ
+    txbuffer[16]=0xA0;  
+    txbuffer[17]=0x00; // Vendor OUI
+    txbuffer[18]=0xB0;  
+    txbuffer[19]=0x52;  
+}
+
+void composeSlacParamCnf(struct slacCandidate *c) {
+
+    memset(txbuffer, 0x00, 60);  // clear txbuffer
+    setMacAt(c->mac, 0);  // Destination MAC
+    setMacAt(myMac, 6);  // Source MAC
+    txbuffer[12]=0x88; // Protocol HomeplugAV
+    txbuffer[13]=0xE1;
+    txbuffer[14]=0x01; // version
+    txbuffer[15]=0x65; // SLAC_PARAM.CNF
+    txbuffer[16]=0x60; // 
+    txbuffer[17]=0x00; // 2 bytes fragmentation information. 0000 means: unfragmented.
+    txbuffer[18]=0x00; // 
+    txbuffer[19]=0xff; // 19-24 sound target
+    txbuffer[20]=0xff; 
+    txbuffer[21]=0xff; 
+    txbuffer[22]=0xff; 
+    txbuffer[23]=0xff; 
+    txbuffer[24]=0xff; 
+    txbuffer[25]=0x0A; // sound count
+    txbuffer[26]=0x06; // timeout
+    txbuffer[27]=0x01; // resptype
+    setMacAt(c->mac, 28);  // forwarding_sta, same as PEV MAC, plus 2 bytes 00 00
+    txbuffer[34]=0x00; // 
+    txbuffer[35]=0x00; // 
+    setRunIdAt(c->runId, 36);  // 36 to 43 runid 8 bytes 
+    // rest is 00
+}
+
+ void composeAttenCharInd(struct slacCandidate *c) {
+    
+    memset(txbuffer, 0x00, 130);  // clear txbuffer
+    setMacAt(c->mac, 0);  // Destination MAC
+    setMacAt(myMac, 6);  // Source MAC
+    txbuffer[12]=0x88; // Protocol HomeplugAV
+    txbuffer[13]=0xE1;
+    txbuffer[14]=0x01; // version
+    txbuffer[15]=0x6E; // ATTEN_CHAR.IND
+    txbuffer[16]=0x60;  
+    txbuffer[17]=0x00; // 2 bytes fragmentation information. 0000 means: unfragmented.
+    txbuffer[18]=0x00; // 
+    txbuffer[19]=0x00; // apptype
+    txbuffer[20]=0x00; // security
+    setMacAt(c->mac, 21); // Mac address of the EV Host which initiates the SLAC process
+    setRunIdAt(c->runId, 27); // RunId 8 bytes 
+    txbuffer[35]=0x00; // 35 - 51 source_id, 17 bytes 0x00 (defined in ISO15118-3 table A.4)
+        
+    txbuffer[52]=0x00; // 52 - 68 response_id, 17 bytes 0x00. (defined in ISO15118-3 table A.4)
+    
+    txbuffer[69]=c->receivedSounds; // Number of sounds. 10 in normal case. 
+    txbuffer[70]=0x3A; // Number of groups = 58. (defined in ISO15118-3 table A.4)
+    setACVarField(c->avgACVar, 71); // 71 to 128: The group attenuation for the 58 announced groups.
+ }
+
+
+void composeSlacMatchCnf() {
+    
+    memset(txbuffer, 0x00, 109);  // clear txbuffer
+    setMacAt(pevMac, 0);  // Destination MAC
+    setMacAt(myMac, 6);  // Source MAC
+    txbuffer[12]=0x88; // Protocol HomeplugAV
+    txbuffer[13]=0xE1;
+    txbuffer[14]=0x01; // version
+    txbuffer[15]=0x7D; // SLAC_MATCH.CNF
+    txbuffer[16]=0x60; // 
+    txbuffer[17]=0x00; // 2 bytes fragmentation information. 0000 means: unfragmented.
+    txbuffer[18]=0x00; // 
+    txbuffer[19]=0x00; // apptype
+    txbuffer[20]=0x00; // security
+    txbuffer[21]=0x56; // length 2 byte
+    txbuffer[22]=0x00;  
+                          // 23 - 39: pev_id 17 bytes. All zero.
+    setMacAt(pevMac, 40); // Pev Mac address
+                          // 46 - 62: evse_id 17 bytes. All zero.
+    setMacAt(myMac, 63);  // 63 - 68 evse_mac 
+    setRunIdAt(pevRunId, 69); // runid 8 bytes 69-76 run_id.
+                          // 77 to 84 reserved 0
+    setNidAt(85);         // 85-91 NID. We can nearly freely choose this, but the upper two bits need to be zero
+                          // 92 reserved 0                                  
+    setNmkAt(93);         // 93 to 108 NMK. We can freely choose this. Normally we should use a random number. 
+}        
+
+void composeFactoryDefaults() {
+
+    memset(txbuffer, 0x00, 60);  // clear buffer
+    txbuffer[0]=0x00; // Destination MAC
+    txbuffer[1]=0xB0;
+    txbuffer[2]=0x52;
+    txbuffer[3]=0x00;
+    txbuffer[4]=0x00;
+    txbuffer[5]=0x01;                
+    setMacAt(myMac, 6); // Source MAC          
+    txbuffer[12]=0x88; // Protocol HomeplugAV
+    txbuffer[13]=0xE1;
+    txbuffer[14]=0x00; // version
+    txbuffer[15]=0x7C; // Load modem Factory Defaults (same as holding GPIO3 low for 15 secs)
+    txbuffer[16]=0xA0; 
+    txbuffer[17]=0x00; 
+    txbuffer[18]=0xB0; 
+    txbuffer[19]=0x52; 
+}
+
+struct slacStep *slacStepOf(uint8_t state) {
+    if (state == MODEM_GET_SW_REQ) state = MODEM_WAIT_SW;
+    for (uint8_t i = 0; i < SLAC_STEPS; i++) {
+        if (slacSteps[i].state == state) return &slacSteps[i];
+    }
+    return NULL;
+}
+
+void recordSlacStep(uint8_t state, uint32_t ms) {
+    struct slacStep *step = slacStepOf(state);
+
+    if (step == NULL) return;
+    step->lastMs = ms;
+    if (ms > step->maxMs) step->maxMs = ms;
+}
+
+// The slots are looked up for every sound and profile. A small fixed array keeps that cost constant.
+struct slacCandidate *candidateByMac(const uint8_t *mac) {
+    for (uint8_t i = 0; i < SLAC_CANDIDATES; i++) {
+        if (slacCandidates[i].state != SLAC_FREE && memcmp(slacCandidates[i].mac, mac, 6) == 0) return &slacCandidates[i];
+    }
+    return NULL;
+}
+
+struct slacCandidate *candidateByRunId(const uint8_t *runId) {
+    for (uint8_t i = 0; i < SLAC_CANDIDATES; i++) {
+        if (slacCandidates[i].state != SLAC_FREE && memcmp(slacCandidates[i].runId, runId, 8) == 0) return &slacCandidates[i];
+    }
+    return NULL;
+}
+
+// The slot for a CM_SLAC_PARAM.REQ: the one the EV had before, else the free slot which is unused the longest.
+// NULL if all slots are busy.
+struct slacCandidate *candidateFor(const uint8_t *mac) {
+    struct slacCandidate *c, *oldest = NULL;
+    unsigned long now = millis();
+
+    for (c = slacCandidates; c < slacCandidates + SLAC_CANDIDATES; c++) {
+        if (memcmp(c->mac, mac, 6) == 0) return c;
+        if (c->state == SLAC_FREE && (oldest == NULL || now - c->timer > now - oldest->timer)) oldest = c;
+    }
+    if (oldest) {
+        memcpy(oldest->mac, mac, 6);
+        oldest->attempts = 0;
+    }
+    return oldest;
+}
+
+// Moves a candidate on to the next state, and keeps the time the step took.
+void candidateEnter(struct slacCandidate *c, uint8_t state) {
+    recordSlacStep(c->state, millis() - c->timer);
+    c->timer = millis();
+    c->retries = 0;
+    c->state = state;
+}
+
+// The run failed, the EV starts a new one. This is no failure of the SLAC layer: before its CM_SLAC_MATCH.REQ
+// we cannot tell our EV from one at the charger next to us, whose runs end here all the time. Only a
+// matched EV which does not join counts against the budget, see checkSlacTimeouts().
+void candidateFailed(struct slacCandidate *c, const char *reason) {
+    WebSerial.printf("[SLAC] %s, attempt %u failed\n", reason, c->attempts);
+    candidateEnter(c, SLAC_FREE);
+}
+
+// Moves the SLAC on to the next modem_state, and keeps the time the step took.
+void slacEnter(uint8_t state) {
+    recordSlacStep(modem_state, millis() - SlacTimer);
+    SlacTimer = millis();
+    modem_state = state;
+}
+
+// The lowest attenuation of the other EVs which are done sounding, 0xFFFF without any. Only for the log:
+// in ISO 15118-3 the EV compares the attenuation of the chargers, and sends its CM_SLAC_MATCH.REQ to one.
+uint16_t otherAttenuation(struct slacCandidate *c) {
+    uint16_t lowest = 0xFFFF;
+
+    for (uint8_t i = 0; i < SLAC_CANDIDATES; i++) {
+        struct slacCandidate *other = &slacCandidates[i];
+        if (other != c && (other->state == ATTEN_CHAR_IND || other->state == ATTEN_CHAR_RSP) && other->attenuation < lowest) lowest = other->attenuation;
+    }
+    return lowest;
+}
+
+// This EV joins our AVLN. The other runs end without an answer, their EVs match with their own charger.
+void matchCandidate(struct slacCandidate *c) {
+    socEstimate_reset(); // a new SLAC, the EV may have been unplugged since its last session
+    memcpy(pevMac, c->mac, 6);
+    memcpy(pevRunId, c->runId, 8);
+    plugInTimer = c->plugIn;
+    SlacAttempts = c->attempts;
+    candidateEnter(c, SLAC_FREE);
+    for (uint8_t i = 0; i < SLAC_CANDIDATES; i++) slacCandidates[i].state = SLAC_FREE;
+    slacEnter(MODEM_GET_SW_REQ);
+}
+
+// All sounds are in, or the sound timer expired: send the averaged attenuation profile to the EV.
+void finishSounding(struct slacCandidate *c) {
+    uint8_t x;
+    uint16_t sum = 0;
+
+    if (c->receivedProfiles) for (x=0; x<58; x++) c->avgACVar[x] = c->avgACVar[x] / c->receivedProfiles;
+    for (x=0; x<58; x++) sum += c->avgACVar[x];
+    c->attenuation = c->receivedProfiles ? sum / 58 : 0xFFFF; // nothing heard
+    composeAttenCharInd(c);
+    qcaspi_write_burst(txbuffer, 129); // Send data to modem
+    WebSerial.printf("transmitting CM_ATTEN_CHAR.IND, %u of %u sounds after %lu ms\n", c->receivedSounds, c->expectedSounds,
+        millis() - c->timer);
+    candidateEnter(c, ATTEN_CHAR_IND);
+}
+
+// Called by the Timer20ms task. An EV did not answer within the timer of the step: repeat our message
+// where the standard has retries, else its run failed, and the EV starts a new one.
+void checkSlacTimeouts(void) {
+    struct slacCandidate *c;
+    struct slacStep *step;
+    uint32_t ms;
+
+    for (c = slacCandidates; c < slacCandidates + SLAC_CANDIDATES; c++) {
+        step = slacStepOf(c->state);
+        ms = millis() - c->timer;
+        if (step == NULL || ms <= (uint32_t)step->timeoutMs * (c->retries + 1)) continue;
+
+        switch (c->state) {
+            case MNBC_SOUND:
+                // some sounds or profiles got lost, send what we have
+                WebSerial.printf("SOUND timer expired\n");
+                finishSounding(c);
+                break;
+
+            case ATTEN_CHAR_IND:
+                if (c->retries < C_EV_MATCH_RETRY) {
+                    c->retries++;
+                    composeAttenCharInd(c);
+                    qcaspi_write_burst(txbuffer, 129);
+                    WebSerial.printf("retransmitting CM_ATTEN_CHAR.IND (%u)\n", c->retries);
+                    break;
+                }
+                // no retries left
+                /* fallthrough */
+            default:
+                WebSerial.printf("[SLAC] no %s within %lu ms\n", step->waitsFor, (unsigned long)ms);
+                candidateFailed(c, "SLAC timeout");
+                break;
+        }
+    }
+
+    // After the match, the EV's modem has to join our AVLN. If it does not, the modem gets a new NMK.
+    step = slacStepOf(modem_state);
+    ms = millis() - SlacTimer;
+    if (step && ms > step->timeoutMs) {
+        WebSerial.printf("[SLAC] no %s within %lu ms, attempt %u failed\n", step->waitsFor, (unsigned long)ms, SlacAttempts);
+        slacEnter(modem_state); // keeps the time of the failed step
+        recoverFrom(RECOVER_SLAC, "SLAC timeout");
+    }
+}
+
+// Received SLAC messages from the PEV are handled here
+void SlacManager(uint16_t rxbytes) {
+    uint16_t mnt, x;
+    struct slacCandidate *c;
+
+    mnt = getManagementMessageType();
+  
+  //  Serial.print("[RX] ");
+  //  for (x=0; x<rxbytes; x++) WebSerial.printf("%02x ",rxbuffer[x]);
+  //  WebSerial.printf("\n");
+
+    if (mnt == (CM_SET_KEY + MMTYPE_CNF)) {
+        WebSerial.printf("received SET_KEY.CNF\n");
+        if (rxbuffer[19] == 0x01) {
+            modem_state = MODEM_CONFIGURED;
+            SetKeyRetries = 0;
+            // copy MAC from the EVSE modem to myModemMac. This MAC is not used for communication.
+            memcpy(myModemMac, rxbuffer+6, 6);
+            WebSerial.printf("NMK set\n");
+            if (Rearming) {
+                uint32_t ms = millis() - RearmTimer;
+                Rearming = 0;
+                RearmCount++;
+                if (ms > RearmMaxMs) RearmMaxMs = ms;
+                WebSerial.printf("[Session] ready for SLAC %lu ms after the teardown, %lu ms worst of %lu\n",
+                    (unsigned long)ms, (unsigned long)RearmMaxMs, (unsigned long)RearmCount);
+            }
+        } else WebSerial.printf("NMK -NOT- set\n");
+
+    } else if (mnt == (CM_SLAC_PARAM + MMTYPE_REQ)) {
+        WebSerial.printf("received CM_SLAC_PARAM.REQ\n");
+        // Matched, we only answer our EV, which starts over when it lost the link.
+        if (modem_state >= MODEM_GET_SW_REQ && memcmp(pevMac, rxbuffer+6, 6) != 0) return;
+        if (recoveryHolds(RECOVER_SLAC)) {
+            WebSerial.printf("SLAC restart pending, CM_SLAC_PARAM.REQ ignored\n"); // the EV repeats it
+            return;
+        }
+        c = candidateFor(rxbuffer+6);
+        if (c == NULL) {
+            WebSerial.printf("no free SLAC slot, CM_SLAC_PARAM.REQ ignored\n"); // the EV repeats it
+            return;
+        }
+        if (c->state == SLAC_PARAM_CNF && memcmp(c->runId, rxbuffer+21, 8) == 0) {
+            // The EV repeats its request, our CM_SLAC_PARAM.CNF got lost. Answer again, in the same run.
+            composeSlacParamCnf(c);
+            qcaspi_write_burst(txbuffer, 60);
+            WebSerial.printf("retransmitting CM_SLAC_PARAM.CNF\n");
+            return;
+        }
+        // A new run. After a long silence, it is a new plug-in.
+        if (c->attempts == 0 || millis() - c->timer > TT_EVSE_SLAC_INIT_MS) {
+            c->plugIn = millis();
+            c->attempts = 0;
+        }
+        c->attempts++;
+        if (modem_state >= MODEM_GET_SW_REQ) modem_state = MODEM_CONFIGURED; // our EV, unmatched again
+        // We received a SLAC_PARAM request from the PEV. This is the initiation of a SLAC procedure.
+        // extract the RunId from the SlacParamReq, and store it for later use
+        memcpy(c->runId, rxbuffer+21, 8);
+        // We are EVSE, we want to answer.
+        composeSlacParamCnf(c);
+        qcaspi_write_burst(txbuffer, 60); // Send data to modem
+        candidateEnter(c, SLAC_PARAM_CNF);
+        WebSerial.printf("transmitting CM_SLAC_PARAM.CNF, SLAC attempt %u\n", c->attempts);
+
+    } else if (mnt == (CM_START_ATTEN_CHAR + MMTYPE_IND)) {
+        // The EV sends it three times, the repeats find us in MNBC_SOUND.
+        c = candidateByMac(rxbuffer+6);
+        if (c == NULL || c->state != SLAC_PARAM_CNF || memcmp(c->runId, rxbuffer+30, 8) != 0) return;
+        WebSerial.printf("received CM_START_ATTEN_CHAR.IND\n");
+        memset(c->avgACVar, 0x00, sizeof(c->avgACVar)); // reset averages.
+        c->receivedSounds = 0;
+        c->receivedProfiles = 0;
+        c->expectedSounds = rxbuffer[21] ? rxbuffer[21] : SLAC_SOUNDS; // NUM_SOUNDS
+        candidateEnter(c, MNBC_SOUND);
+
+    } else if (mnt == (CM_MNBC_SOUND + MMTYPE_IND)) { 
+        c = candidateByMac(rxbuffer+6);
+        if (c == NULL || c->state != MNBC_SOUND) return;
+        WebSerial.printf("received CM_MNBC_SOUND.IND\n");
+        c->receivedSounds++;
+
+    } else if (mnt == (CM_ATTEN_PROFILE + MMTYPE_IND) && rxbytes >= 27+58) { 
+        // this and the next two messages are longer than the 60 bytes every packet has, so their length is checked above
+        c = candidateByMac(rxbuffer+19); // the EV whose sound our modem measured
+        if (c == NULL || c->state != MNBC_SOUND) return;
+        WebSerial.printf("received CM_ATTEN_PROFILE.IND\n");
+        for (x=0; x<58; x++) c->avgACVar[x] += rxbuffer[27+x];
+        // the profile follows its sound, so with the last profile we have all there is to measure
+        if (++c->receivedProfiles >= c->expectedSounds) finishSounding(c);
+
+    } else if (mnt == (CM_ATTEN_CHAR + MMTYPE_RSP) && rxbytes >= 70) { 
+        c = candidateByRunId(rxbuffer+27);
+        if (c == NULL || c->state != ATTEN_CHAR_IND) return;
+        WebSerial.printf("received CM_ATTEN_CHAR.RSP\n");
+        // verify pevMac, RunID, and succesful Slac fields
+        if (memcmp(c->mac, rxbuffer+21, 6) == 0 && rxbuffer[69] == 0) {
+            WebSerial.printf("Successful SLAC process\n");
+            candidateEnter(c, ATTEN_CHAR_RSP);
+        } else candidateFailed(c, "CM_ATTEN_CHAR.RSP not accepted");
+
+    } else if (mnt == (CM_SLAC_MATCH + MMTYPE_REQ) && rxbytes >= 69+8) { 
+        WebSerial.printf("received CM_SLAC_MATCH.REQ\n"); 
+        // Verify MVFLength, pevMac and RunID fields
+        if (rxbuffer[21] != 0x3e) return;
+        if ((modem_state == MODEM_GET_SW_REQ || modem_state == MODEM_WAIT_SW) &&
+            memcmp(pevMac, rxbuffer+40, 6) == 0 && memcmp(pevRunId, rxbuffer+69, 8) == 0) {
+            // the EV repeats its request, our CM_SLAC_MATCH.CNF got lost. The modem search goes on.
+            composeSlacMatchCnf();
+            qcaspi_write_burst(txbuffer, 109);
+            WebSerial.printf("retransmitting CM_SLAC_MATCH.CNF\n");
+            return;
+        }
+        c = candidateByRunId(rxbuffer+69);
+        if (c == NULL || c->state != ATTEN_CHAR_RSP || memcmp(c->mac, rxbuffer+40, 6) != 0) return;
+        // the EV chose us, answer it. An EV we hear better may still be plugged into the charger next to us.
+        if (otherAttenuation(c) < c->attenuation) WebSerial.printf("another EV has %u dB attenuation, less than this one\n", otherAttenuation(c));
+        matchCandidate(c);
+        composeSlacMatchCnf();
+        qcaspi_write_burst(txbuffer, 109); // Send data to modem
+        WebSerial.printf("transmitting CM_SLAC_MATCH.CNF, %u dB attenuation\n", c->attenuation);
+
+    } else if (mnt == (CM_GET_SW + MMTYPE_CNF) && (modem_state == MODEM_WAIT_SW || modem_state == MODEM_LINK_CHECK)) { 
+        // Both the local and Pev modem will send their software version.
+        // check if the MAC of the modem is the same as our local modem.
+        if (memcmp(rxbuffer+6, myModemMac, 6) != 0) { 
+            // Store the Pev modem MAC, as long as it is not random, we can use it for identifying the EV (Autocharge / Plug N Charge)
+            memcpy(pevModemMac, rxbuffer+6, 6);
+        }
+        WebSerial.printf("received GET_SW.CNF\n");
+        ModemsFound++;
+        if (modem_state == MODEM_WAIT_SW && ModemsFound >= 2) linkReady();
+    }
+}
+
+// Both modems answered the GET_SW.REQ, the EV is in our private network.
+void linkReady(void) {
+    uint8_t x;
+    uint32_t ms;
+
+    WebSerial.printf("Found %u modems after %lu ms. Private network between EVSE and PEV established\n", ModemsFound,
+        millis() - ModemSearchTimer);
+
+    WebSerial.printf("PEV MAC: ");
+    for(x=0; x<6 ;x++) WebSerial.printf("%02x", pevMac[x]);
+    WebSerial.printf(" PEV modem MAC: ");
+    for(x=0; x<6 ;x++) WebSerial.printf("%02x", pevModemMac[x]);
+    WebSerial.printf("\n");
+
+    slacEnter(MODEM_LINK_READY);
+    ms = recordTiming(&plugInToLink);
+    WebSerial.printf("Link ready %lu ms after plug-in, SLAC attempt %u. %lu links: %lu ms best, %lu ms average, %lu ms worst\n",
+        (unsigned long)ms, SlacAttempts, (unsigned long)plugInToLink.count, (unsigned long)plugInToLink.minMs,
+        (unsigned long)(plugInToLink.sumMs / plugInToLink.count), (unsigned long)plugInToLink.maxMs);
+    WebSerial.printf("SLAC steps, last/worst:");
+    for (x = 0; x < SLAC_STEPS; x++) {
+        WebSerial.printf(" %s %lu/%lu ms", slacSteps[x].waitsFor, (unsigned long)slacSteps[x].lastMs, (unsigned long)slacSteps[x].maxMs);
+    }
+    WebSerial.printf("\n");
+
+    WebSerial.println("Initial SOC Callback triggered.");
+
+    String evccid_str = macArrayToString(pevMac);
+    
+    sendSocCallback(
+        (float)EVSOC,        
+        0.0,                  
+        0.0,                  
+        0.0,                  
+        evccid_str,
+        0                     // no SoC yet
+    );
+    
+    // Transition to next V2G state (important to prevent repeated calls)
+    modem_state = MODEM_V2G_INIT; 
+    LinkCheckTimer = millis(); // the EV opens its TCP connection now, the first link check is due later
+}
+
+// The end of a V2G session. An EV which comes back for a SoC refresh stays in our AVLN, it then skips the SLAC.
+// Otherwise the next EV gets a fresh start.
+void sessionEnded(const char *reason) {
+    if (socRefresh_scheduled()) {
+        LinkCheckTimer = millis();
+        return;
+    }
+    rearmModem(reason);
+}
+
+// Forget the EV, and give the modem a new NMK. The modem of the previous EV keeps the old one, which takes it
+// out of our AVLN. Ready for the next SLAC with the SET_KEY.CNF, see SET_KEY_TIMEOUT_MS for the bound.
+// A V2G session which is still open, e.g. one the EV began while its link check was out, ends here too.
+void rearmModem(const char *reason) {
+    WebSerial.printf("[Session] teardown: %s\n", reason);
+    if (v2gSessionRunning()) resetV2GSession(reason); // the EV is gone, and TCP and V2G with it
+    socRefresh_stop();
+    EVSOC = 0;
+    memset(EVCCID, 0, sizeof(EVCCID));
+    memset(pevMac, 0, sizeof(pevMac));
+    memset(pevModemMac, 0, sizeof(pevModemMac));
+    memset(pevRunId, 0, sizeof(pevRunId));
+    memset(slacCandidates, 0, sizeof(slacCandidates));
+    SlacAttempts = 0;
+    RearmTimer = millis();
+    Rearming = 1;
+    SetKeyRetries = 0;
+    modem_state = MODEM_CM_SET_KEY_REQ;
+}
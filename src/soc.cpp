@@ -0,0 +1,203 @@
+#include <Arduino.h>
+#include "main.h"
+#include "tcp.h"
+#include "soc.h"
+#include <WebSerial.h>
+
+/* The EV tells its SoC once per V2G session, in the ChargeParameterDiscoveryReq. A SoC-only session ends right
+   after it, and the EV charges over AC for hours. To keep the SoC up to date, the EVSE asks for a new session
+   now and then, see controlPilot_requestSession().
+
+   The modem keeps its NMK between the sessions. An EV which is still matched to our AVLN skips the SLAC, and
+   starts right away with the SDP. */
+
+#define SOC_REFRESH_IDLE 0      /* no EV, or it stopped answering */
+#define SOC_REFRESH_WAITING 1   /* we have the SoC, the next refresh is due after socRefreshNext */
+#define SOC_REFRESH_REQUESTED 2 /* asked for a session, waiting for its SoC */
+
+uint32_t socRefreshInterval = SOC_REFRESH_INTERVAL_MS; /* configured, 0 switches the refresh off */
+uint32_t socRefreshNext;    /* adapted to how fast the SoC changes */
+uint8_t socRefreshState = SOC_REFRESH_IDLE;
+uint8_t socRefreshRetries;
+unsigned long socRefreshTimer; /* millis() of the last SoC, or of the last session request */
+unsigned long socSampleTime;   /* millis() of the last SoC */
+uint8_t socSample;
+
+/* The board controls no control pilot, the SmartEVSE does. Its driver replaces these two functions. It restarts
+   the V2G session the way ISO 15118-3 has it for a wake-up: a short 100% duty cycle, then 5% again. Without a
+   driver no refresh is scheduled, and the EV leaves our AVLN after its session, as without the refresh. */
+uint8_t __attribute__((weak)) controlPilot_available(void) {
+    return 0;
+}
+
+void __attribute__((weak)) controlPilot_requestSession(void) {
+    WebSerial.printf("[SoC] refresh due, but there is no control pilot driver to restart the session\n");
+}
+
+/* Aim for a refresh every SOC_REFRESH_STEP percent. A SoC which does not move doubles the interval. */
+void adaptSocRefreshInterval(unsigned long now, uint8_t soc) {
+    uint32_t elapsed = now - socSampleTime;
+
+    if (soc > socSample) {
+        socRefreshNext = (uint32_t)((uint64_t)elapsed * SOC_REFRESH_STEP / (soc - socSample));
+    } else if (socRefreshNext < SOC_REFRESH_MAX_MS / 2) {
+        socRefreshNext *= 2;
+    } else {
+        socRefreshNext = SOC_REFRESH_MAX_MS;
+    }
+    if (socRefreshNext < SOC_REFRESH_MIN_MS) socRefreshNext = SOC_REFRESH_MIN_MS;
+    if (socRefreshNext > SOC_REFRESH_MAX_MS) socRefreshNext = SOC_REFRESH_MAX_MS;
+    WebSerial.printf("[SoC] %u%%, was %u%% %lu s ago. Next refresh in %lu s\n", soc, socSample,
+        (unsigned long)(elapsed / 1000), (unsigned long)(socRefreshNext / 1000));
+}
+
+/* Called with the SoC of every ChargeParameterDiscoveryReq. Returns 1 if the session was one of our refreshes,
+   0 if the EV was just plugged in. */
+uint8_t socRefresh_received(uint8_t soc) {
+    unsigned long now = millis();
+    uint8_t refresh = (socRefreshState == SOC_REFRESH_REQUESTED);
+
+    if (refresh) {
+        adaptSocRefreshInterval(now, soc);
+    } else {
+        socRefreshNext = socRefreshInterval;
+    }
+    socSample = soc;
+    socSampleTime = now;
+    socRefreshTimer = now;
+    socRefreshRetries = 0;
+    socRefreshState = (socOnlySession && socRefreshInterval && controlPilot_available()) ? SOC_REFRESH_WAITING : SOC_REFRESH_IDLE;
+    return refresh;
+}
+
+/* 1 while we expect the EV to come back for a refresh. Then it stays in our AVLN. */
+uint8_t socRefresh_scheduled(void) {
+    return socRefreshState != SOC_REFRESH_IDLE;
+}
+
+/* No more refreshes, e.g. the modem forgets the EV after its session. The EV may still charge, so the estimate
+   goes on until the EV leaves, see socEstimate_reset(). */
+void socRefresh_stop(void) {
+    socRefreshState = SOC_REFRESH_IDLE;
+}
+
+/* Called by the Timer20ms task. Also runs the estimator. */
+void socRefresh_poll(void) {
+    unsigned long now = millis();
+
+    socEstimate_update(now);
+
+    switch (socRefreshState) {
+    case SOC_REFRESH_WAITING:
+        if (now - socRefreshTimer < socRefreshNext || v2gSessionRunning()) return;
+        break;
+    case SOC_REFRESH_REQUESTED:
+        if (now - socRefreshTimer < SOC_REFRESH_TIMEOUT_MS || v2gSessionRunning()) return;
+        if (++socRefreshRetries > SOC_REFRESH_RETRIES) {
+            // no session after several tries. The EV may still charge in our AVLN, the link check finds out if it is gone.
+            WebSerial.printf("[SoC] no session after %u refresh requests, stopping the refresh\n", SOC_REFRESH_RETRIES);
+            socRefreshState = SOC_REFRESH_IDLE;
+            return;
+        }
+        break;
+    default:
+        return;
+    }
+    controlPilot_requestSession();
+    socRefreshState = SOC_REFRESH_REQUESTED;
+    socRefreshTimer = now;
+}
+
+
+/* Estimation between the reads **********************************************************************************/
+/* The SmartEVSE measures the AC power it delivers, and pushes it to /api/power. Integrated over time, and with
+   the EVEnergyCapacity of the ChargeParameterDiscoveryReq, this gives the SoC between two real reads. Each
+   read corrects the estimate, and teaches it the charging efficiency of the EV. */
+
+float socEstimate;             /* % */
+float socAtRead;               /* % of the last read */
+float socEnergyCapacity;       /* Wh, 0 when the EV did not tell */
+float socEnergySinceRead;      /* Wh delivered since the last read */
+float socFullSoc, socEnergyRequest; /* of the last read, published along with the estimate */
+float socChargeEfficiency = SOC_CHARGE_EFFICIENCY; /* learned from the reads */
+float socEstimateError = SOC_ESTIMATE_ERROR;       /* relative error of the estimated change, learned from the reads */
+float socPublished;
+uint8_t socEvccid[6];          /* of the last read, the session's EVCCID is cleared when the modem forgets the EV */
+unsigned long socPublishTimer;
+unsigned long socIntegrateTimer;
+
+/* written by the web server task, read by the Timer20ms task */
+volatile float pushedPower;               /* W */
+volatile unsigned long pushedPowerTime;   /* millis(), 0 for none yet */
+
+void socEstimate_pushPower(float watts) {
+    pushedPower = watts;
+    pushedPowerTime = millis();
+}
+
+/* The EV left: it was unplugged, or a new SLAC begins with the next one. Nothing learned yet, and no estimate
+   until its first read. */
+void socEstimate_reset(void) {
+    socEnergyCapacity = 0;
+    socChargeEfficiency = SOC_CHARGE_EFFICIENCY;
+    socEstimateError = SOC_ESTIMATE_ERROR;
+}
+
+/* A real SoC from the EV. */
+void socEstimate_correct(uint8_t soc, float fullSoc, float energyCapacity, float energyRequest) {
+    float change = socEstimate - socAtRead;
+
+    if (socEnergyCapacity > 0 && socEnergySinceRead > energyCapacity * SOC_LEARN_MIN_CHANGE / 100) {
+        // enough energy went in to tell the efficiency apart from the 1% steps of the SoC
+        float efficiency = (soc - socAtRead) / 100 * energyCapacity / socEnergySinceRead;
+        float error = fabsf(soc - socEstimate) / (change > 1 ? change : 1);
+
+        if (efficiency < SOC_EFFICIENCY_MIN) efficiency = SOC_EFFICIENCY_MIN;
+        if (efficiency > 1) efficiency = 1;
+        socChargeEfficiency = (socChargeEfficiency + efficiency) / 2;
+        socEstimateError = (socEstimateError + error) / 2;
+        if (socEstimateError < SOC_ESTIMATE_ERROR_MIN) socEstimateError = SOC_ESTIMATE_ERROR_MIN;
+        WebSerial.printf("[SoC] estimated %.1f%%, read %u%%. Charging efficiency %.0f%%, estimate error %.0f%%\n",
+            socEstimate, soc, socChargeEfficiency * 100, socEstimateError * 100);
+    }
+    socEstimate = socAtRead = socPublished = soc;
+    socFullSoc = fullSoc;
+    socEnergyCapacity = energyCapacity;
+    socEnergyRequest = energyRequest;
+    memcpy(socEvccid, EVCCID, sizeof(socEvccid));
+    socEnergySinceRead = 0;
+    socIntegrateTimer = socPublishTimer = millis();
+}
+
+/* 100 right after a read. It falls as the estimate moves away from it, and is 0 without fresh power readings. */
+uint8_t socEstimate_confidence(void) {
+    float uncertainty = (socEstimate - socAtRead) * socEstimateError; // % SoC
+
+    if (socEnergyCapacity <= 0 || pushedPowerTime == 0 || millis() - pushedPowerTime > SOC_POWER_TIMEOUT_MS) return 0;
+    if (uncertainty >= SOC_ESTIMATE_MAX_UNCERTAINTY) return 0;
+    return (uint8_t)(100 * (1 - uncertainty / SOC_ESTIMATE_MAX_UNCERTAINTY));
+}
+
+/* Called by the Timer20ms task, from socRefresh_poll(). */
+void socEstimate_update(unsigned long now) {
+    uint8_t confidence;
+    float energyRequest;
+
+    if (socEnergyCapacity <= 0) return;
+    if (pushedPowerTime != 0 && now - pushedPowerTime <= SOC_POWER_TIMEOUT_MS && pushedPower > 0) {
+        socEnergySinceRead += pushedPower * (now - socIntegrateTimer) / 3600000.0f;
+        socEstimate = socAtRead + socEnergySinceRead * socChargeEfficiency / socEnergyCapacity * 100;
+        if (socEstimate > 100) socEstimate = 100;
+    }
+    socIntegrateTimer = now;
+
+    // the callback blocks on the HTTP server, never while the EV waits for a response
+    if (now - socPublishTimer < SOC_ESTIMATE_PUBLISH_MS || v2gSessionRunning()) return;
+    if (socEstimate - socPublished < SOC_ESTIMATE_PUBLISH_STEP) return;
+    confidence = socEstimate_confidence();
+    if (confidence == 0) return;
+    socPublishTimer = now;
+    socPublished = socEstimate;
+    energyRequest = socEnergyRequest - socEnergySinceRead * socChargeEfficiency;
+    sendSocCallback(socEstimate, socFullSoc, socEnergyCapacity, energyRequest > 0 ? energyRequest : 0, macArrayToString(socEvccid), confidence);
+}
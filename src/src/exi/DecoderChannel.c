@@ -50,9 +50,11 @@
 #define MAX_OCTETS_FOR_UNSIGNED_INTEGER_64 10
 /* unsigned int == 32 bits, 5 * 7bits = 35 bits */
 #define MAX_OCTETS_FOR_UNSIGNED_INTEGER_32 5
+/* unsigned short == 16 bits, 3 * 7bits = 21 bits */
+#define MAX_OCTETS_FOR_UNSIGNED_INTEGER_16 3
 
 /* buffer for reading (arbitrary) large integer values */
-static uint8_t maskedOctets[MAX_OCTETS_FOR_UNSIGNED_INTEGER_64];
+static EXI_THREAD_LOCAL uint8_t maskedOctets[MAX_OCTETS_FOR_UNSIGNED_INTEGER_64];
 
 
 static int _decodeUnsignedInteger(bitstream_t* stream, exi_integer_t* iv, int negative) {
@@ -171,13 +173,15 @@ int decodeUnsignedInteger16(bitstream_t* stream, uint16_t* uint16) {
 	*uint16 = 0;
 
 	do {
+		/* a longer sequence does not fit, and would shift beyond the width of the type */
+		if (mShift >= 7 * MAX_OCTETS_FOR_UNSIGNED_INTEGER_16) return EXI_UNSUPPORTED_INTEGER_VALUE;
 		/* 1. Read the next octet */
 		errn = decode(stream, &b);
 		/* 2. Multiply the value of the unsigned number represented by the 7
 		 * least significant
 		 * bits of the octet by the current multiplier and add the result to
 		 * the current value */
-		*uint16 = (uint16_t)(*uint16 + ((b & 127) << mShift));
+		*uint16 = (uint16_t)(*uint16 + ((uint32_t)(b & 127) << mShift));
 		/* 3. Multiply the multiplier by 128 */
 		mShift += 7;
 		/* 4. If the most significant bit of the octet was 1, go back to step 1 */
@@ -194,13 +198,15 @@ int decodeUnsignedInteger32(bitstream_t* stream, uint32_t* uint32) {
 	*uint32 = 0;
 
 	do {
+		/* a longer sequence does not fit, and would shift beyond the width of the type */
+		if (mShift >= 7 * MAX_OCTETS_FOR_UNSIGNED_INTEGER_32) return EXI_UNSUPPORTED_INTEGER_VALUE;
 		/* 1. Read the next octet */
 		errn = decode(stream, &b);
 		/* 2. Multiply the value of the unsigned number represented by the 7
 		 * least significant
 		 * bits of the octet by the current multiplier and add the result to
 		 * the current value */
-		*uint32 += (uint32_t)((b & 127) << mShift);
+		*uint32 += (uint32_t)((uint64_t)(b & 127) << mShift);
 		/* 3. Multiply the multiplier by 128 */
 		mShift += 7;
 		/* 4. If the most significant bit of the octet was 1, go back to step 1 */
@@ -254,6 +260,8 @@ int decodeUnsignedInteger64(bitstream_t* stream, uint64_t* uint64) {
 	*uint64 = 0L;
 
 	do {
+		/* a longer sequence does not fit, and would shift beyond the width of the type */
+		if (mShift >= 7 * MAX_OCTETS_FOR_UNSIGNED_INTEGER_64) return EXI_UNSUPPORTED_INTEGER_VALUE;
 		errn = decode(stream, &b);
 		*uint64 += ((uint64_t) (b & 127)) << mShift;
 		mShift += 7;
@@ -791,10 +799,12 @@ int decodeCharacters(bitstream_t* stream, size_t len, exi_string_character_t* ch
 	uint8_t b;
 	for (i = 0; i < len && errn == 0; i++) {
 		errn = decode(stream, &b);
-		if(b < 128) {
-			chars[i] = (exi_string_character_t)b;
-		} else {
-			errn = EXI_ERROR_STRINGVALUES_CHARACTER;
+		if(errn == 0) {
+			if(b < 128) {
+				chars[i] = (exi_string_character_t)b;
+			} else {
+				errn = EXI_ERROR_STRINGVALUES_CHARACTER;
+			}
 		}
 	}
 	/* null terminator \0 */
@@ -836,10 +846,12 @@ int decodeRCSCharacters(bitstream_t* stream, size_t len, exi_string_character_t*
 				/* RCS deviation */
 #if STRING_REPRESENTATION == STRING_REPRESENTATION_ASCII
 				errn = decode(stream, &b);
-				if(b < 128) {
-					chars[i] = (exi_string_character_t)b;
-				} else {
-					errn = EXI_ERROR_STRINGVALUES_CHARACTER;
+				if(errn == 0) {
+					if(b < 128) {
+						chars[i] = (exi_string_character_t)b;
+					} else {
+						errn = EXI_ERROR_STRINGVALUES_CHARACTER;
+					}
 				}
 #endif /* STRING_REPRESENTATION_ASCII */
 #if STRING_REPRESENTATION == STRING_REPRESENTATION_UCS
@@ -880,7 +892,9 @@ int decodeBinary(bitstream_t* stream, exi_bytes_t* bytes) {
 #endif /* DYNAMIC_ALLOCATION */
 		}
 
-		errn = decodeBytes(stream, bytes->len, bytes->data);
+		if (errn == 0) {
+			errn = decodeBytes(stream, bytes->len, bytes->data);
+		}
 	}
 
 	return errn;
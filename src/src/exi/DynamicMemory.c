@@ -0,0 +1,78 @@
+/*
+ * Bump arena for MEMORY_ALLOCATION == DYNAMIC_ALLOCATION. See DynamicMemory.h.
+ */
+
+#include "DynamicMemory.h"
+#include "ErrorCodes.h"
+
+#if MEMORY_ALLOCATION == DYNAMIC_ALLOCATION
+
+#define ARENA_ALIGN(n) (((n) + sizeof(void*) - 1) & ~(sizeof(void*) - 1))
+
+static EXI_THREAD_LOCAL struct exiDynamicMemory* currentMemory;
+
+void exiDynamicMemoryUse(struct exiDynamicMemory* memory) {
+	currentMemory = memory;
+}
+
+void exiDynamicMemoryReset(struct exiDynamicMemory* memory) {
+	memory->used = 0;
+}
+
+static void* allocate(size_t size) {
+	struct exiDynamicMemory* m = currentMemory;
+	void* p;
+	if (m == NULL || size > EXI_DYNAMIC_MEMORY_SIZE - m->used) {
+		return NULL;
+	}
+	p = &m->bytes[m->used];
+	m->used += ARENA_ALIGN(size);
+	if (m->used > EXI_DYNAMIC_MEMORY_SIZE) {
+		m->used = EXI_DYNAMIC_MEMORY_SIZE;
+	}
+	return p;
+}
+
+static void release(void* p, size_t size) {
+	struct exiDynamicMemory* m = currentMemory;
+	/* only the last block can be given back */
+	if (m != NULL && p != NULL && (uint8_t*)p + ARENA_ALIGN(size) == &m->bytes[m->used]) {
+		m->used -= ARENA_ALIGN(size);
+	}
+}
+
+int exiAllocateDynamicStringMemory(exi_string_t* s, size_t length) {
+	s->characters = (exi_string_character_t*)allocate(length * sizeof(exi_string_character_t));
+	if (s->characters == NULL) {
+		s->size = 0;
+		return EXI_ERROR_OUT_OF_STRING_BUFFER;
+	}
+	s->size = length;
+	return 0;
+}
+
+int exiAllocateDynamicBinaryMemory(exi_bytes_t* bytes, size_t length) {
+	bytes->data = (uint8_t*)allocate(length);
+	if (bytes->data == NULL) {
+		bytes->size = 0;
+		return EXI_ERROR_OUT_OF_BYTE_BUFFER;
+	}
+	bytes->size = length;
+	return 0;
+}
+
+int exiFreeDynamicStringMemory(exi_string_t* s) {
+	release(s->characters, s->size * sizeof(exi_string_character_t));
+	s->characters = NULL;
+	s->size = 0;
+	return 0;
+}
+
+int exiFreeDynamicBinaryMemory(exi_bytes_t* bytes) {
+	release(bytes->data, bytes->size);
+	bytes->data = NULL;
+	bytes->size = 0;
+	return 0;
+}
+
+#endif /* DYNAMIC_ALLOCATION */
@@ -0,0 +1,54 @@
+/*
+ * Dynamic memory of the EXI decoder, for MEMORY_ALLOCATION == DYNAMIC_ALLOCATION.
+ *
+ * There is no malloc behind it. Each codec context owns a bump arena, the decoder takes the
+ * string and binary containers it needs from the arena of the calling thread, and
+ * exiCodec_resetArena() drops them all at once when the request/response exchange is over.
+ * Freeing a single block only gives it back if it was the last one taken.
+ */
+
+#ifndef DYNAMIC_MEMORY_H
+#define DYNAMIC_MEMORY_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "EXIConfig.h"
+#include "EXITypes.h"
+
+#if MEMORY_ALLOCATION == DYNAMIC_ALLOCATION
+
+/** bytes per context for the decoded strings and binaries of one message */
+#ifndef EXI_DYNAMIC_MEMORY_SIZE
+#define EXI_DYNAMIC_MEMORY_SIZE 1024
+#endif
+
+struct exiDynamicMemory {
+	size_t used;
+	uint8_t bytes[EXI_DYNAMIC_MEMORY_SIZE];
+};
+
+/**
+ * \brief 	Selects the arena the calling thread allocates from
+ * \param	memory		Arena, NULL for none
+ */
+void exiDynamicMemoryUse(struct exiDynamicMemory* memory);
+
+/**
+ * \brief 	Frees all blocks of an arena
+ */
+void exiDynamicMemoryReset(struct exiDynamicMemory* memory);
+
+int exiAllocateDynamicStringMemory(exi_string_t* s, size_t length);
+int exiAllocateDynamicBinaryMemory(exi_bytes_t* bytes, size_t length);
+int exiFreeDynamicStringMemory(exi_string_t* s);
+int exiFreeDynamicBinaryMemory(exi_bytes_t* bytes);
+
+#endif /* DYNAMIC_ALLOCATION */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DYNAMIC_MEMORY_H */
@@ -64,9 +64,13 @@ extern "C" {
 /** */
 /** \brief 	Memory allocation mode
  *
- * 			static or dynamic memory allocation
+ * 			static or dynamic memory allocation. Dynamic takes the containers of the
+ * 			generic string and binary decoders from a per context bump arena, see
+ * 			DynamicMemory.h. The generated documents have fixed arrays in both modes.
  * */
+#ifndef MEMORY_ALLOCATION
 #define MEMORY_ALLOCATION STATIC_ALLOCATION
+#endif
 
 
 
@@ -79,7 +83,7 @@ extern "C" {
  *
  * 			ASCII or UCS
  * */
-#define STRING_REPRESENTATION STRING_REPRESENTATION_UCS
+#define STRING_REPRESENTATION STRING_REPRESENTATION_ASCII
 
 
 /* in the case of ASCII an extra char (null terminator) for printf and other functions is useful */
@@ -97,6 +101,16 @@ extern "C" {
 /** Maximum number of cascading elements, XML tree depth */
 #define EXI_ELEMENT_STACK_SIZE 24
 
+/** \brief 	Storage of the coder scratch variables
+ *
+ * 			The generated coders keep their event code and error number in file scope
+ * 			variables. With one copy per thread, two exiCodecContext can run on
+ * 			different tasks at the same time. Define it empty for a single threaded target.
+ * */
+#ifndef EXI_THREAD_LOCAL
+#define EXI_THREAD_LOCAL __thread
+#endif
+
 
 #ifdef __cplusplus
 }
@@ -456,7 +456,12 @@ int encodeCharacters(bitstream_t* stream, exi_string_character_t* chars, size_t
 	int errn = 0;
 	for (i = 0; i < len && errn == 0; i++) {
 #if STRING_REPRESENTATION == STRING_REPRESENTATION_ASCII
-		errn = encode(stream, (uint8_t)chars[i]);
+		/* a code point below 128 is a single octet Unsigned Integer, everything else is not ASCII */
+		if ((uint8_t)chars[i] < 128) {
+			errn = encode(stream, (uint8_t)chars[i]);
+		} else {
+			errn = EXI_ERROR_STRINGVALUES_CHARACTER;
+		}
 #endif /* STRING_REPRESENTATION_ASCII */
 #if STRING_REPRESENTATION == STRING_REPRESENTATION_UCS
 		errn = encodeUnsignedInteger32(stream, chars[i]);
@@ -485,7 +490,13 @@ int encodeRCSCharacters(bitstream_t* stream, exi_string_character_t* chars, size
 			/* RCS mis-match */
 			errn = encodeNBitUnsignedInteger(stream, rcsCodeLength, rcsSize);
 #if STRING_REPRESENTATION == STRING_REPRESENTATION_ASCII
-			errn = encode(stream, (uint8_t)chars[i]);
+			if (errn == 0) {
+				if ((uint8_t)chars[i] < 128) {
+					errn = encode(stream, (uint8_t)chars[i]);
+				} else {
+					errn = EXI_ERROR_STRINGVALUES_CHARACTER;
+				}
+			}
 #endif /* STRING_REPRESENTATION_ASCII */
 #if STRING_REPRESENTATION == STRING_REPRESENTATION_UCS
 			errn = encodeUnsignedInteger32(stream, chars[i]);
@@ -110,6 +110,8 @@ extern "C" {
 
 
 #define EXI_DEVIANT_SUPPORT_NOT_DEPLOYED -500
+#define EXI_ERROR_NOT_IN_DEPLOYMENT_PROFILE -501
+#define EXI_ERROR_NOT_IN_PROJECTION -502
 
 #ifdef __cplusplus
 }
@@ -42,9 +42,9 @@
 #define EXI_appHand_DATATYPES_DECODER_C
 
 /** event-code */
-static uint32_t eventCode;
-static int errn;
-static uint32_t uint32;
+static EXI_THREAD_LOCAL uint32_t eventCode;
+static EXI_THREAD_LOCAL int errn;
+static EXI_THREAD_LOCAL uint32_t uint32;
 
 
 /* Forward Declarations */
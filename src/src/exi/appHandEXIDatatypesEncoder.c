@@ -41,7 +41,7 @@
 #ifndef EXI_appHand_DATATYPES_ENCODER_C
 #define EXI_appHand_DATATYPES_ENCODER_C
 
-static int errn;
+static EXI_THREAD_LOCAL int errn;
 
 /* Forward Declarations */
 static int encode_appHandAppProtocolType(bitstream_t* stream, struct appHandAppProtocolType* appHandAppProtocolType);
@@ -0,0 +1,90 @@
+/*
+ * Protocol negotiation for the supportedAppProtocolReq. See appHandNegotiation.h.
+ */
+
+#include "appHandNegotiation.h"
+
+#include <string.h>
+
+struct supportedProtocol {
+	const char* ns;
+	uint8_t nsLen;
+	uint8_t major;
+	uint8_t minor;
+	uint8_t protocol;
+};
+
+#define NAMESPACE(s) s, (uint8_t)(sizeof(s) - 1)
+
+/* The protocols we run, in the order we prefer them. */
+static const struct supportedProtocol supportedProtocols[] = {
+	{ NAMESPACE("urn:din:70121:2012:MsgDef"), 2, 0, APPHAND_PROTOCOL_DIN },
+};
+
+#define SUPPORTED_PROTOCOLS (sizeof(supportedProtocols) / sizeof(supportedProtocols[0]))
+
+/* index into supportedProtocols, or -1 */
+static int findProtocol(const struct appHandAppProtocolType* app) {
+	uint16_t len = app->ProtocolNamespace.charactersLen;
+	unsigned int i;
+	for (i = 0; i < SUPPORTED_PROTOCOLS; i++) {
+		if (len == supportedProtocols[i].nsLen
+				&& app->VersionNumberMajor == supportedProtocols[i].major
+				&& memcmp(app->ProtocolNamespace.characters, supportedProtocols[i].ns, len) == 0) {
+			return (int)i;
+		}
+	}
+	return -1;
+}
+
+/* 1 if the entry with (priority, preference) is a better choice than the best one so far */
+static int isBetter(uint8_t priority, int preference, uint8_t bestPriority, int bestPreference) {
+#if APPHAND_POLICY == APPHAND_POLICY_SECC
+	if (preference != bestPreference) return preference < bestPreference;
+	return priority < bestPriority;
+#else
+	if (priority != bestPriority) return priority < bestPriority;
+	return preference < bestPreference;
+#endif
+}
+
+void appHand_negotiate(const struct appHandAnonType_supportedAppProtocolReq* req, struct appHandNegotiation* result) {
+	int best = -1, preference;
+	uint16_t n;
+	const struct appHandAppProtocolType* app;
+	const struct appHandAppProtocolType* chosen = NULL;
+
+	result->protocol = APPHAND_PROTOCOL_NONE;
+	result->SchemaID = 0;
+	result->responseCode = appHandresponseCodeType_Failed_NoNegotiation;
+	result->evPriority = 0;
+	result->offered = (uint8_t)req->AppProtocol.arrayLen;
+	result->matched = 0;
+
+	for (n = 0; n < req->AppProtocol.arrayLen; n++) {
+		app = &req->AppProtocol.array[n];
+		preference = findProtocol(app);
+		if (preference < 0) continue;
+		result->matched++;
+		if (chosen == NULL || isBetter(app->Priority, preference, chosen->Priority, best)) {
+			chosen = app;
+			best = preference;
+		}
+	}
+
+	if (chosen != NULL) {
+		result->protocol = supportedProtocols[best].protocol;
+		result->SchemaID = chosen->SchemaID;
+		result->evPriority = chosen->Priority;
+		result->responseCode = (chosen->VersionNumberMinor == supportedProtocols[best].minor) ?
+				appHandresponseCodeType_OK_SuccessfulNegotiation :
+				appHandresponseCodeType_OK_SuccessfulNegotiationWithMinorDeviation;
+	}
+}
+
+const char* appHand_protocolName(uint8_t protocol) {
+	switch (protocol) {
+	case APPHAND_PROTOCOL_DIN: return "DIN 70121";
+	default: return "none";
+	}
+}
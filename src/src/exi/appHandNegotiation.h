@@ -0,0 +1,59 @@
+/*
+ * Protocol negotiation for the supportedAppProtocolReq.
+ *
+ * The EV lists the protocols it speaks, each with namespace, version, SchemaID and its Priority
+ * (1 is the most wanted). appHand_negotiate() matches that list against the protocols this SECC
+ * supports, and picks exactly one entry, or none. The namespaces are compared by length first and
+ * only then by content, so most entries are rejected without looking at their characters.
+ */
+
+#ifndef APPHAND_NEGOTIATION_H
+#define APPHAND_NEGOTIATION_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+#include "appHandEXIDatatypes.h"
+
+/* Protocols the SECC can run after the handshake */
+#define APPHAND_PROTOCOL_DIN 0
+#define APPHAND_PROTOCOLS 1
+#define APPHAND_PROTOCOL_NONE 0xFF
+
+/* Which side decides among the protocols both support. With APPHAND_POLICY_EV the EV's Priority
+   counts first, and our preference only breaks ties. With APPHAND_POLICY_SECC it is the other way round. */
+#define APPHAND_POLICY_EV 0
+#define APPHAND_POLICY_SECC 1
+#ifndef APPHAND_POLICY
+#define APPHAND_POLICY APPHAND_POLICY_EV
+#endif
+
+struct appHandNegotiation {
+	uint8_t protocol; /* APPHAND_PROTOCOL_*, APPHAND_PROTOCOL_NONE if nothing matched */
+	uint8_t SchemaID; /* the EV's SchemaID of the chosen entry, to be sent back */
+	uint8_t responseCode; /* appHandresponseCodeType for the supportedAppProtocolRes */
+	uint8_t evPriority; /* the EV's Priority of the chosen entry */
+	uint8_t offered; /* entries in the request */
+	uint8_t matched; /* entries we could have run */
+};
+
+/**
+ * \brief 	Chooses one protocol of a supportedAppProtocolReq
+ * \param	req			The decoded request
+ * \param	result		The choice, and what is needed for the response
+ */
+void appHand_negotiate(const struct appHandAnonType_supportedAppProtocolReq* req, struct appHandNegotiation* result);
+
+/**
+ * \brief 	Name of an APPHAND_PROTOCOL_*, for the log
+ */
+const char* appHand_protocolName(uint8_t protocol);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* APPHAND_NEGOTIATION_H */
@@ -46,6 +46,13 @@ extern "C" {
 #define SUPPORT_NO 2
 #define DEPLOY_DIN_CODEC SUPPORT_YES
 #define DEPLOY_DIN_CODEC_FRAGMENT SUPPORT_NO
+/* SECC profile: decode only requests and encode only responses, without the xmldsig signature types.
+   The other directions answer EXI_ERROR_NOT_IN_DEPLOYMENT_PROFILE, the compiler drops their now unused code.
+   Can be overridden with -DDEPLOY_DIN_CODEC_SECC_ONLY=2 (SUPPORT_NO) in the build flags. */
+#ifndef DEPLOY_DIN_CODEC_SECC_ONLY
+#define DEPLOY_DIN_CODEC_SECC_ONLY SUPPORT_YES
+#endif
+#define DEPLOY_DIN_CODEC_DEBUG_TRACE SUPPORT_NO /* line trace into gDebugString, costs a sprintf on every decode */
 
 #if DEPLOY_DIN_CODEC == SUPPORT_YES
 
@@ -41,15 +41,24 @@
 #ifndef EXI_din_DATATYPES_DECODER_C
 #define EXI_din_DATATYPES_DECODER_C
 
+#if DEPLOY_DIN_CODEC_DEBUG_TRACE == SUPPORT_YES
 extern void debugAddStringAndInt(char *s, int i);
+#else
+#define debugAddStringAndInt(s, i)
+#endif /* DEPLOY_DIN_CODEC_DEBUG_TRACE */
 
 
 #if DEPLOY_DIN_CODEC == SUPPORT_YES
 
+#if DEPLOY_DIN_CODEC_SECC_ONLY == SUPPORT_YES
+/* the other direction is not referenced in the SECC profile, and dropped by the compiler */
+#pragma GCC diagnostic ignored "-Wunused-function"
+#endif /* DEPLOY_DIN_CODEC_SECC_ONLY */
+
 /** event-code */
-static uint32_t eventCode;
-static int errn;
-static uint32_t uint32;
+static EXI_THREAD_LOCAL uint32_t eventCode;
+static EXI_THREAD_LOCAL int errn;
+static EXI_THREAD_LOCAL uint32_t uint32;
 
 /* Forward Declarations */
 static int decode_dinMeteringReceiptReqType(bitstream_t* stream, struct dinMeteringReceiptReqType* dinMeteringReceiptReqType);
@@ -363,10 +372,14 @@ static int decode_dinBodyType(bitstream_t* stream, struct dinBodyType* dinBodyTy
 					debugAddStringAndInt("Line", __LINE__);
 					break;
 				case 2:
+#if DEPLOY_DIN_CODEC_SECC_ONLY == SUPPORT_NO
 					errn = decode_dinCableCheckResType(stream, &dinBodyType->CableCheckRes);
 					dinBodyType->CableCheckRes_isUsed = 1u;
 					grammarID = 4;
 					debugAddStringAndInt("Line", __LINE__);
+#else
+					errn = EXI_ERROR_NOT_IN_DEPLOYMENT_PROFILE;
+#endif /* DEPLOY_DIN_CODEC_SECC_ONLY */
 					break;
 				case 3:
 					errn = decode_dinCertificateInstallationReqType(stream, &dinBodyType->CertificateInstallationReq);
@@ -375,10 +388,14 @@ static int decode_dinBodyType(bitstream_t* stream, struct dinBodyType* dinBodyTy
 					debugAddStringAndInt("Line", __LINE__);
 					break;
 				case 4:
+#if DEPLOY_DIN_CODEC_SECC_ONLY == SUPPORT_NO
 					errn = decode_dinCertificateInstallationResType(stream, &dinBodyType->CertificateInstallationRes);
 					dinBodyType->CertificateInstallationRes_isUsed = 1u;
 					grammarID = 4;
 					debugAddStringAndInt("Line", __LINE__);
+#else
+					errn = EXI_ERROR_NOT_IN_DEPLOYMENT_PROFILE;
+#endif /* DEPLOY_DIN_CODEC_SECC_ONLY */
 					break;
 				case 5:
 					errn = decode_dinCertificateUpdateReqType(stream, &dinBodyType->CertificateUpdateReq);
@@ -387,10 +404,14 @@ static int decode_dinBodyType(bitstream_t* stream, struct dinBodyType* dinBodyTy
 					debugAddStringAndInt("Line", __LINE__);
 					break;
 				case 6:
+#if DEPLOY_DIN_CODEC_SECC_ONLY == SUPPORT_NO
 					errn = decode_dinCertificateUpdateResType(stream, &dinBodyType->CertificateUpdateRes);
 					dinBodyType->CertificateUpdateRes_isUsed = 1u;
 					grammarID = 4;
 					debugAddStringAndInt("Line", __LINE__);
+#else
+					errn = EXI_ERROR_NOT_IN_DEPLOYMENT_PROFILE;
+#endif /* DEPLOY_DIN_CODEC_SECC_ONLY */
 					break;
 				case 7:
 					errn = decode_dinChargeParameterDiscoveryReqType(stream, &dinBodyType->ChargeParameterDiscoveryReq);
@@ -399,10 +420,14 @@ static int decode_dinBodyType(bitstream_t* stream, struct dinBodyType* dinBodyTy
 					debugAddStringAndInt("Line", __LINE__);
 					break;
 				case 8:
+#if DEPLOY_DIN_CODEC_SECC_ONLY == SUPPORT_NO
 					errn = decode_dinChargeParameterDiscoveryResType(stream, &dinBodyType->ChargeParameterDiscoveryRes);
 					dinBodyType->ChargeParameterDiscoveryRes_isUsed = 1u;
 					grammarID = 4;
 					debugAddStringAndInt("Line", __LINE__);
+#else
+					errn = EXI_ERROR_NOT_IN_DEPLOYMENT_PROFILE;
+#endif /* DEPLOY_DIN_CODEC_SECC_ONLY */
 					break;
 				case 9:
 					errn = decode_dinChargingStatusReqType(stream, &dinBodyType->ChargingStatusReq);
@@ -411,10 +436,14 @@ static int decode_dinBodyType(bitstream_t* stream, struct dinBodyType* dinBodyTy
 					debugAddStringAndInt("Line", __LINE__);
 					break;
 				case 10:
+#if DEPLOY_DIN_CODEC_SECC_ONLY == SUPPORT_NO
 					errn = decode_dinChargingStatusResType(stream, &dinBodyType->ChargingStatusRes);
 					dinBodyType->ChargingStatusRes_isUsed = 1u;
 					grammarID = 4;
 					debugAddStringAndInt("Line", __LINE__);
+#else
+					errn = EXI_ERROR_NOT_IN_DEPLOYMENT_PROFILE;
+#endif /* DEPLOY_DIN_CODEC_SECC_ONLY */
 					break;
 				case 11:
 					errn = decode_dinContractAuthenticationReqType(stream, &dinBodyType->ContractAuthenticationReq);
@@ -423,10 +452,14 @@ static int decode_dinBodyType(bitstream_t* stream, struct dinBodyType* dinBodyTy
 					debugAddStringAndInt("Line", __LINE__);
 					break;
 				case 12:
+#if DEPLOY_DIN_CODEC_SECC_ONLY == SUPPORT_NO
 					errn = decode_dinContractAuthenticationResType(stream, &dinBodyType->ContractAuthenticationRes);
 					dinBodyType->ContractAuthenticationRes_isUsed = 1u;
 					grammarID = 4;
 					debugAddStringAndInt("Line", __LINE__);
+#else
+					errn = EXI_ERROR_NOT_IN_DEPLOYMENT_PROFILE;
+#endif /* DEPLOY_DIN_CODEC_SECC_ONLY */
 					break;
 				case 13:
 					errn = decode_dinCurrentDemandReqType(stream, &dinBodyType->CurrentDemandReq);
@@ -435,10 +468,14 @@ static int decode_dinBodyType(bitstream_t* stream, struct dinBodyType* dinBodyTy
 					debugAddStringAndInt("Line", __LINE__);
 					break;
 				case 14:
+#if DEPLOY_DIN_CODEC_SECC_ONLY == SUPPORT_NO
 					errn = decode_dinCurrentDemandResType(stream, &dinBodyType->CurrentDemandRes);
 					dinBodyType->CurrentDemandRes_isUsed = 1u;
 					grammarID = 4;
 					debugAddStringAndInt("Line", __LINE__);
+#else
+					errn = EXI_ERROR_NOT_IN_DEPLOYMENT_PROFILE;
+#endif /* DEPLOY_DIN_CODEC_SECC_ONLY */
 					break;
 				case 15:
 					errn = decode_dinMeteringReceiptReqType(stream, &dinBodyType->MeteringReceiptReq);
@@ -447,10 +484,14 @@ static int decode_dinBodyType(bitstream_t* stream, struct dinBodyType* dinBodyTy
 					debugAddStringAndInt("Line", __LINE__);
 					break;
 				case 16:
+#if DEPLOY_DIN_CODEC_SECC_ONLY == SUPPORT_NO
 					errn = decode_dinMeteringReceiptResType(stream, &dinBodyType->MeteringReceiptRes);
 					dinBodyType->MeteringReceiptRes_isUsed = 1u;
 					grammarID = 4;
 					debugAddStringAndInt("Line", __LINE__);
+#else
+					errn = EXI_ERROR_NOT_IN_DEPLOYMENT_PROFILE;
+#endif /* DEPLOY_DIN_CODEC_SECC_ONLY */
 					break;
 				case 17:
 					errn = decode_dinPaymentDetailsReqType(stream, &dinBodyType->PaymentDetailsReq);
@@ -459,10 +500,14 @@ static int decode_dinBodyType(bitstream_t* stream, struct dinBodyType* dinBodyTy
 					debugAddStringAndInt("Line", __LINE__);
 					break;
 				case 18:
+#if DEPLOY_DIN_CODEC_SECC_ONLY == SUPPORT_NO
 					errn = decode_dinPaymentDetailsResType(stream, &dinBodyType->PaymentDetailsRes);
 					dinBodyType->PaymentDetailsRes_isUsed = 1u;
 					grammarID = 4;
 					debugAddStringAndInt("Line", __LINE__);
+#else
+					errn = EXI_ERROR_NOT_IN_DEPLOYMENT_PROFILE;
+#endif /* DEPLOY_DIN_CODEC_SECC_ONLY */
 					break;
 				case 19:
 					errn = decode_dinPowerDeliveryReqType(stream, &dinBodyType->PowerDeliveryReq);
@@ -471,10 +516,14 @@ static int decode_dinBodyType(bitstream_t* stream, struct dinBodyType* dinBodyTy
 					debugAddStringAndInt("Line", __LINE__);
 					break;
 				case 20:
+#if DEPLOY_DIN_CODEC_SECC_ONLY == SUPPORT_NO
 					errn = decode_dinPowerDeliveryResType(stream, &dinBodyType->PowerDeliveryRes);
 					dinBodyType->PowerDeliveryRes_isUsed = 1u;
 					grammarID = 4;
 					debugAddStringAndInt("Line", __LINE__);
+#else
+					errn = EXI_ERROR_NOT_IN_DEPLOYMENT_PROFILE;
+#endif /* DEPLOY_DIN_CODEC_SECC_ONLY */
 					break;
 				case 21:
 					errn = decode_dinPreChargeReqType(stream, &dinBodyType->PreChargeReq);
@@ -483,10 +532,14 @@ static int decode_dinBodyType(bitstream_t* stream, struct dinBodyType* dinBodyTy
 					debugAddStringAndInt("Line", __LINE__);
 					break;
 				case 22:
+#if DEPLOY_DIN_CODEC_SECC_ONLY == SUPPORT_NO
 					errn = decode_dinPreChargeResType(stream, &dinBodyType->PreChargeRes);
 					dinBodyType->PreChargeRes_isUsed = 1u;
 					grammarID = 4;
 					debugAddStringAndInt("Line", __LINE__);
+#else
+					errn = EXI_ERROR_NOT_IN_DEPLOYMENT_PROFILE;
+#endif /* DEPLOY_DIN_CODEC_SECC_ONLY */
 					break;
 				case 23:
 					errn = decode_dinServiceDetailReqType(stream, &dinBodyType->ServiceDetailReq);
@@ -495,10 +548,14 @@ static int decode_dinBodyType(bitstream_t* stream, struct dinBodyType* dinBodyTy
 					grammarID = 4;
 					break;
 				case 24:
+#if DEPLOY_DIN_CODEC_SECC_ONLY == SUPPORT_NO
 					errn = decode_dinServiceDetailResType(stream, &dinBodyType->ServiceDetailRes);
 					dinBodyType->ServiceDetailRes_isUsed = 1u;
 					grammarID = 4;
 					debugAddStringAndInt("Line", __LINE__);
+#else
+					errn = EXI_ERROR_NOT_IN_DEPLOYMENT_PROFILE;
+#endif /* DEPLOY_DIN_CODEC_SECC_ONLY */
 					break;
 				case 25:
 					errn = decode_dinServiceDiscoveryReqType(stream, &dinBodyType->ServiceDiscoveryReq);
@@ -507,10 +564,14 @@ static int decode_dinBodyType(bitstream_t* stream, struct dinBodyType* dinBodyTy
 					debugAddStringAndInt("Line", __LINE__);
 					break;
 				case 26:
+#if DEPLOY_DIN_CODEC_SECC_ONLY == SUPPORT_NO
 					errn = decode_dinServiceDiscoveryResType(stream, &dinBodyType->ServiceDiscoveryRes);
 					dinBodyType->ServiceDiscoveryRes_isUsed = 1u;
 					grammarID = 4;
 					debugAddStringAndInt("Line", __LINE__);
+#else
+					errn = EXI_ERROR_NOT_IN_DEPLOYMENT_PROFILE;
+#endif /* DEPLOY_DIN_CODEC_SECC_ONLY */
 					break;
 				case 27:
 					errn = decode_dinServicePaymentSelectionReqType(stream, &dinBodyType->ServicePaymentSelectionReq);
@@ -519,10 +580,14 @@ static int decode_dinBodyType(bitstream_t* stream, struct dinBodyType* dinBodyTy
 					debugAddStringAndInt("Line", __LINE__);
 					break;
 				case 28:
+#if DEPLOY_DIN_CODEC_SECC_ONLY == SUPPORT_NO
 					errn = decode_dinServicePaymentSelectionResType(stream, &dinBodyType->ServicePaymentSelectionRes);
 					dinBodyType->ServicePaymentSelectionRes_isUsed = 1u;
 					grammarID = 4;
 					debugAddStringAndInt("Line", __LINE__);
+#else
+					errn = EXI_ERROR_NOT_IN_DEPLOYMENT_PROFILE;
+#endif /* DEPLOY_DIN_CODEC_SECC_ONLY */
 					break;
 				case 29:
 					errn = decode_dinSessionSetupReqType(stream, &dinBodyType->SessionSetupReq);
@@ -531,10 +596,14 @@ static int decode_dinBodyType(bitstream_t* stream, struct dinBodyType* dinBodyTy
 					debugAddStringAndInt("Line", __LINE__);
 					break;
 				case 30:
+#if DEPLOY_DIN_CODEC_SECC_ONLY == SUPPORT_NO
 					errn = decode_dinSessionSetupResType(stream, &dinBodyType->SessionSetupRes);
 					dinBodyType->SessionSetupRes_isUsed = 1u;
 					grammarID = 4;
 					debugAddStringAndInt("Line", __LINE__);
+#else
+					errn = EXI_ERROR_NOT_IN_DEPLOYMENT_PROFILE;
+#endif /* DEPLOY_DIN_CODEC_SECC_ONLY */
 					break;
 				case 31:
 					errn = decode_dinSessionStopType(stream, &dinBodyType->SessionStopReq);
@@ -543,10 +612,14 @@ static int decode_dinBodyType(bitstream_t* stream, struct dinBodyType* dinBodyTy
 					debugAddStringAndInt("Line", __LINE__);
 					break;
 				case 32:
+#if DEPLOY_DIN_CODEC_SECC_ONLY == SUPPORT_NO
 					errn = decode_dinSessionStopResType(stream, &dinBodyType->SessionStopRes);
 					dinBodyType->SessionStopRes_isUsed = 1u;
 					grammarID = 4;
 					debugAddStringAndInt("Line", __LINE__);
+#else
+					errn = EXI_ERROR_NOT_IN_DEPLOYMENT_PROFILE;
+#endif /* DEPLOY_DIN_CODEC_SECC_ONLY */
 					break;
 				case 33:
 					errn = decode_dinWeldingDetectionReqType(stream, &dinBodyType->WeldingDetectionReq);
@@ -555,10 +628,14 @@ static int decode_dinBodyType(bitstream_t* stream, struct dinBodyType* dinBodyTy
 					debugAddStringAndInt("Line", __LINE__);
 					break;
 				case 34:
+#if DEPLOY_DIN_CODEC_SECC_ONLY == SUPPORT_NO
 					errn = decode_dinWeldingDetectionResType(stream, &dinBodyType->WeldingDetectionRes);
 					dinBodyType->WeldingDetectionRes_isUsed = 1u;
 					grammarID = 4;
 					debugAddStringAndInt("Line", __LINE__);
+#else
+					errn = EXI_ERROR_NOT_IN_DEPLOYMENT_PROFILE;
+#endif /* DEPLOY_DIN_CODEC_SECC_ONLY */
 					break;
 				case 35:
 					done = 1;
@@ -5181,9 +5258,13 @@ static int decode_dinMessageHeaderType(bitstream_t* stream, struct dinMessageHea
 					grammarID = 110;
 					break;
 				case 1:
+#if DEPLOY_DIN_CODEC_SECC_ONLY == SUPPORT_NO
 					errn = decode_dinSignatureType(stream, &dinMessageHeaderType->Signature);
 					dinMessageHeaderType->Signature_isUsed = 1u;
 					grammarID = 4;
+#else
+					errn = EXI_ERROR_NOT_IN_DEPLOYMENT_PROFILE;
+#endif /* DEPLOY_DIN_CODEC_SECC_ONLY */
 					break;
 				case 2:
 					done = 1;
@@ -5201,9 +5282,13 @@ static int decode_dinMessageHeaderType(bitstream_t* stream, struct dinMessageHea
 			if (errn == 0) {
 				switch(eventCode) {
 				case 0:
+#if DEPLOY_DIN_CODEC_SECC_ONLY == SUPPORT_NO
 					errn = decode_dinSignatureType(stream, &dinMessageHeaderType->Signature);
 					dinMessageHeaderType->Signature_isUsed = 1u;
 					grammarID = 4;
+#else
+					errn = EXI_ERROR_NOT_IN_DEPLOYMENT_PROFILE;
+#endif /* DEPLOY_DIN_CODEC_SECC_ONLY */
 					break;
 				case 1:
 					done = 1;
@@ -14128,134 +14213,238 @@ int decode_dinExiDocument(bitstream_t* stream, struct dinEXIDocument* exiDoc) {
 		if(errn == 0) {
 			switch(eventCode) {
 			case 0:
+#if DEPLOY_DIN_CODEC_SECC_ONLY == SUPPORT_NO
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}AC_EVChargeParameter) */
 				errn = decode_dinAC_EVChargeParameterType(stream, &exiDoc->AC_EVChargeParameter);
 				exiDoc->AC_EVChargeParameter_isUsed = 1u;
+#else
+				errn = EXI_ERROR_NOT_IN_DEPLOYMENT_PROFILE;
+#endif /* DEPLOY_DIN_CODEC_SECC_ONLY */
 				break;
 			case 1:
+#if DEPLOY_DIN_CODEC_SECC_ONLY == SUPPORT_NO
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}AC_EVSEChargeParameter) */
 				errn = decode_dinAC_EVSEChargeParameterType(stream, &exiDoc->AC_EVSEChargeParameter);
 				exiDoc->AC_EVSEChargeParameter_isUsed = 1u;
+#else
+				errn = EXI_ERROR_NOT_IN_DEPLOYMENT_PROFILE;
+#endif /* DEPLOY_DIN_CODEC_SECC_ONLY */
 				break;
 			case 2:
+#if DEPLOY_DIN_CODEC_SECC_ONLY == SUPPORT_NO
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}AC_EVSEStatus) */
 				errn = decode_dinAC_EVSEStatusType(stream, &exiDoc->AC_EVSEStatus);
 				exiDoc->AC_EVSEStatus_isUsed = 1u;
+#else
+				errn = EXI_ERROR_NOT_IN_DEPLOYMENT_PROFILE;
+#endif /* DEPLOY_DIN_CODEC_SECC_ONLY */
 				break;
 			case 3:
+#if DEPLOY_DIN_CODEC_SECC_ONLY == SUPPORT_NO
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgDef}BodyElement) */
 				errn = decode_dinBodyBaseType(stream, &exiDoc->BodyElement);
 				exiDoc->BodyElement_isUsed = 1u;
+#else
+				errn = EXI_ERROR_NOT_IN_DEPLOYMENT_PROFILE;
+#endif /* DEPLOY_DIN_CODEC_SECC_ONLY */
 				break;
 			case 4:
+#if DEPLOY_DIN_CODEC_SECC_ONLY == SUPPORT_NO
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}CableCheckReq) */
 				errn = decode_dinCableCheckReqType(stream, &exiDoc->CableCheckReq);
 				exiDoc->CableCheckReq_isUsed = 1u;
+#else
+				errn = EXI_ERROR_NOT_IN_DEPLOYMENT_PROFILE;
+#endif /* DEPLOY_DIN_CODEC_SECC_ONLY */
 				break;
 			case 5:
+#if DEPLOY_DIN_CODEC_SECC_ONLY == SUPPORT_NO
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}CableCheckRes) */
 				errn = decode_dinCableCheckResType(stream, &exiDoc->CableCheckRes);
 				exiDoc->CableCheckRes_isUsed = 1u;
+#else
+				errn = EXI_ERROR_NOT_IN_DEPLOYMENT_PROFILE;
+#endif /* DEPLOY_DIN_CODEC_SECC_ONLY */
 				break;
 			case 6:
+#if DEPLOY_DIN_CODEC_SECC_ONLY == SUPPORT_NO
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}CanonicalizationMethod) */
 				errn = decode_dinCanonicalizationMethodType(stream, &exiDoc->CanonicalizationMethod);
 				exiDoc->CanonicalizationMethod_isUsed = 1u;
+#else
+				errn = EXI_ERROR_NOT_IN_DEPLOYMENT_PROFILE;
+#endif /* DEPLOY_DIN_CODEC_SECC_ONLY */
 				break;
 			case 7:
+#if DEPLOY_DIN_CODEC_SECC_ONLY == SUPPORT_NO
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}CertificateInstallationReq) */
 				errn = decode_dinCertificateInstallationReqType(stream, &exiDoc->CertificateInstallationReq);
 				exiDoc->CertificateInstallationReq_isUsed = 1u;
+#else
+				errn = EXI_ERROR_NOT_IN_DEPLOYMENT_PROFILE;
+#endif /* DEPLOY_DIN_CODEC_SECC_ONLY */
 				break;
 			case 8:
+#if DEPLOY_DIN_CODEC_SECC_ONLY == SUPPORT_NO
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}CertificateInstallationRes) */
 				errn = decode_dinCertificateInstallationResType(stream, &exiDoc->CertificateInstallationRes);
 				exiDoc->CertificateInstallationRes_isUsed = 1u;
+#else
+				errn = EXI_ERROR_NOT_IN_DEPLOYMENT_PROFILE;
+#endif /* DEPLOY_DIN_CODEC_SECC_ONLY */
 				break;
 			case 9:
+#if DEPLOY_DIN_CODEC_SECC_ONLY == SUPPORT_NO
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}CertificateUpdateReq) */
 				errn = decode_dinCertificateUpdateReqType(stream, &exiDoc->CertificateUpdateReq);
 				exiDoc->CertificateUpdateReq_isUsed = 1u;
+#else
+				errn = EXI_ERROR_NOT_IN_DEPLOYMENT_PROFILE;
+#endif /* DEPLOY_DIN_CODEC_SECC_ONLY */
 				break;
 			case 10:
+#if DEPLOY_DIN_CODEC_SECC_ONLY == SUPPORT_NO
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}CertificateUpdateRes) */
 				errn = decode_dinCertificateUpdateResType(stream, &exiDoc->CertificateUpdateRes);
 				exiDoc->CertificateUpdateRes_isUsed = 1u;
+#else
+				errn = EXI_ERROR_NOT_IN_DEPLOYMENT_PROFILE;
+#endif /* DEPLOY_DIN_CODEC_SECC_ONLY */
 				break;
 			case 11:
+#if DEPLOY_DIN_CODEC_SECC_ONLY == SUPPORT_NO
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ChargeParameterDiscoveryReq) */
 				errn = decode_dinChargeParameterDiscoveryReqType(stream, &exiDoc->ChargeParameterDiscoveryReq);
 				exiDoc->ChargeParameterDiscoveryReq_isUsed = 1u;
+#else
+				errn = EXI_ERROR_NOT_IN_DEPLOYMENT_PROFILE;
+#endif /* DEPLOY_DIN_CODEC_SECC_ONLY */
 				break;
 			case 12:
+#if DEPLOY_DIN_CODEC_SECC_ONLY == SUPPORT_NO
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ChargeParameterDiscoveryRes) */
 				errn = decode_dinChargeParameterDiscoveryResType(stream, &exiDoc->ChargeParameterDiscoveryRes);
 				exiDoc->ChargeParameterDiscoveryRes_isUsed = 1u;
+#else
+				errn = EXI_ERROR_NOT_IN_DEPLOYMENT_PROFILE;
+#endif /* DEPLOY_DIN_CODEC_SECC_ONLY */
 				break;
 			case 13:
+#if DEPLOY_DIN_CODEC_SECC_ONLY == SUPPORT_NO
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ChargingStatusReq) */
 				errn = decode_dinChargingStatusReqType(stream, &exiDoc->ChargingStatusReq);
 				exiDoc->ChargingStatusReq_isUsed = 1u;
+#else
+				errn = EXI_ERROR_NOT_IN_DEPLOYMENT_PROFILE;
+#endif /* DEPLOY_DIN_CODEC_SECC_ONLY */
 				break;
 			case 14:
+#if DEPLOY_DIN_CODEC_SECC_ONLY == SUPPORT_NO
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ChargingStatusRes) */
 				errn = decode_dinChargingStatusResType(stream, &exiDoc->ChargingStatusRes);
 				exiDoc->ChargingStatusRes_isUsed = 1u;
+#else
+				errn = EXI_ERROR_NOT_IN_DEPLOYMENT_PROFILE;
+#endif /* DEPLOY_DIN_CODEC_SECC_ONLY */
 				break;
 			case 15:
+#if DEPLOY_DIN_CODEC_SECC_ONLY == SUPPORT_NO
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ContractAuthenticationReq) */
 				errn = decode_dinContractAuthenticationReqType(stream, &exiDoc->ContractAuthenticationReq);
 				exiDoc->ContractAuthenticationReq_isUsed = 1u;
+#else
+				errn = EXI_ERROR_NOT_IN_DEPLOYMENT_PROFILE;
+#endif /* DEPLOY_DIN_CODEC_SECC_ONLY */
 				break;
 			case 16:
+#if DEPLOY_DIN_CODEC_SECC_ONLY == SUPPORT_NO
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ContractAuthenticationRes) */
 				errn = decode_dinContractAuthenticationResType(stream, &exiDoc->ContractAuthenticationRes);
 				exiDoc->ContractAuthenticationRes_isUsed = 1u;
+#else
+				errn = EXI_ERROR_NOT_IN_DEPLOYMENT_PROFILE;
+#endif /* DEPLOY_DIN_CODEC_SECC_ONLY */
 				break;
 			case 17:
+#if DEPLOY_DIN_CODEC_SECC_ONLY == SUPPORT_NO
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}CurrentDemandReq) */
 				errn = decode_dinCurrentDemandReqType(stream, &exiDoc->CurrentDemandReq);
 				exiDoc->CurrentDemandReq_isUsed = 1u;
+#else
+				errn = EXI_ERROR_NOT_IN_DEPLOYMENT_PROFILE;
+#endif /* DEPLOY_DIN_CODEC_SECC_ONLY */
 				break;
 			case 18:
+#if DEPLOY_DIN_CODEC_SECC_ONLY == SUPPORT_NO
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}CurrentDemandRes) */
 				errn = decode_dinCurrentDemandResType(stream, &exiDoc->CurrentDemandRes);
 				exiDoc->CurrentDemandRes_isUsed = 1u;
+#else
+				errn = EXI_ERROR_NOT_IN_DEPLOYMENT_PROFILE;
+#endif /* DEPLOY_DIN_CODEC_SECC_ONLY */
 				break;
 			case 19:
+#if DEPLOY_DIN_CODEC_SECC_ONLY == SUPPORT_NO
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}DC_EVChargeParameter) */
 				errn = decode_dinDC_EVChargeParameterType(stream, &exiDoc->DC_EVChargeParameter);
 				exiDoc->DC_EVChargeParameter_isUsed = 1u;
+#else
+				errn = EXI_ERROR_NOT_IN_DEPLOYMENT_PROFILE;
+#endif /* DEPLOY_DIN_CODEC_SECC_ONLY */
 				break;
 			case 20:
+#if DEPLOY_DIN_CODEC_SECC_ONLY == SUPPORT_NO
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}DC_EVPowerDeliveryParameter) */
 				errn = decode_dinDC_EVPowerDeliveryParameterType(stream, &exiDoc->DC_EVPowerDeliveryParameter);
 				exiDoc->DC_EVPowerDeliveryParameter_isUsed = 1u;
+#else
+				errn = EXI_ERROR_NOT_IN_DEPLOYMENT_PROFILE;
+#endif /* DEPLOY_DIN_CODEC_SECC_ONLY */
 				break;
 			case 21:
+#if DEPLOY_DIN_CODEC_SECC_ONLY == SUPPORT_NO
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}DC_EVSEChargeParameter) */
 				errn = decode_dinDC_EVSEChargeParameterType(stream, &exiDoc->DC_EVSEChargeParameter);
 				exiDoc->DC_EVSEChargeParameter_isUsed = 1u;
+#else
+				errn = EXI_ERROR_NOT_IN_DEPLOYMENT_PROFILE;
+#endif /* DEPLOY_DIN_CODEC_SECC_ONLY */
 				break;
 			case 22:
+#if DEPLOY_DIN_CODEC_SECC_ONLY == SUPPORT_NO
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}DC_EVSEStatus) */
 				errn = decode_dinDC_EVSEStatusType(stream, &exiDoc->DC_EVSEStatus);
 				exiDoc->DC_EVSEStatus_isUsed = 1u;
+#else
+				errn = EXI_ERROR_NOT_IN_DEPLOYMENT_PROFILE;
+#endif /* DEPLOY_DIN_CODEC_SECC_ONLY */
 				break;
 			case 23:
+#if DEPLOY_DIN_CODEC_SECC_ONLY == SUPPORT_NO
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}DC_EVStatus) */
 				errn = decode_dinDC_EVStatusType(stream, &exiDoc->DC_EVStatus);
 				exiDoc->DC_EVStatus_isUsed = 1u;
+#else
+				errn = EXI_ERROR_NOT_IN_DEPLOYMENT_PROFILE;
+#endif /* DEPLOY_DIN_CODEC_SECC_ONLY */
 				break;
 			case 24:
+#if DEPLOY_DIN_CODEC_SECC_ONLY == SUPPORT_NO
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}DSAKeyValue) */
 				errn = decode_dinDSAKeyValueType(stream, &exiDoc->DSAKeyValue);
 				exiDoc->DSAKeyValue_isUsed = 1u;
+#else
+				errn = EXI_ERROR_NOT_IN_DEPLOYMENT_PROFILE;
+#endif /* DEPLOY_DIN_CODEC_SECC_ONLY */
 				break;
 			case 25:
+#if DEPLOY_DIN_CODEC_SECC_ONLY == SUPPORT_NO
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}DigestMethod) */
 				errn = decode_dinDigestMethodType(stream, &exiDoc->DigestMethod);
 				exiDoc->DigestMethod_isUsed = 1u;
+#else
+				errn = EXI_ERROR_NOT_IN_DEPLOYMENT_PROFILE;
+#endif /* DEPLOY_DIN_CODEC_SECC_ONLY */
 				break;
 			case 26:
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}DigestValue) */
@@ -14278,39 +14467,67 @@ int decode_dinExiDocument(bitstream_t* stream, struct dinEXIDocument* exiDoc) {
 				}
 				break;
 			case 27:
+#if DEPLOY_DIN_CODEC_SECC_ONLY == SUPPORT_NO
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}EVChargeParameter) */
 				errn = decode_dinEVChargeParameterType(stream, &exiDoc->EVChargeParameter);
 				exiDoc->EVChargeParameter_isUsed = 1u;
+#else
+				errn = EXI_ERROR_NOT_IN_DEPLOYMENT_PROFILE;
+#endif /* DEPLOY_DIN_CODEC_SECC_ONLY */
 				break;
 			case 28:
+#if DEPLOY_DIN_CODEC_SECC_ONLY == SUPPORT_NO
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}EVPowerDeliveryParameter) */
 				errn = decode_dinEVPowerDeliveryParameterType(stream, &exiDoc->EVPowerDeliveryParameter);
 				exiDoc->EVPowerDeliveryParameter_isUsed = 1u;
+#else
+				errn = EXI_ERROR_NOT_IN_DEPLOYMENT_PROFILE;
+#endif /* DEPLOY_DIN_CODEC_SECC_ONLY */
 				break;
 			case 29:
+#if DEPLOY_DIN_CODEC_SECC_ONLY == SUPPORT_NO
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}EVSEChargeParameter) */
 				errn = decode_dinEVSEChargeParameterType(stream, &exiDoc->EVSEChargeParameter);
 				exiDoc->EVSEChargeParameter_isUsed = 1u;
+#else
+				errn = EXI_ERROR_NOT_IN_DEPLOYMENT_PROFILE;
+#endif /* DEPLOY_DIN_CODEC_SECC_ONLY */
 				break;
 			case 30:
+#if DEPLOY_DIN_CODEC_SECC_ONLY == SUPPORT_NO
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}EVSEStatus) */
 				errn = decode_dinEVSEStatusType(stream, &exiDoc->EVSEStatus);
 				exiDoc->EVSEStatus_isUsed = 1u;
+#else
+				errn = EXI_ERROR_NOT_IN_DEPLOYMENT_PROFILE;
+#endif /* DEPLOY_DIN_CODEC_SECC_ONLY */
 				break;
 			case 31:
+#if DEPLOY_DIN_CODEC_SECC_ONLY == SUPPORT_NO
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}EVStatus) */
 				errn = decode_dinEVStatusType(stream, &exiDoc->EVStatus);
 				exiDoc->EVStatus_isUsed = 1u;
+#else
+				errn = EXI_ERROR_NOT_IN_DEPLOYMENT_PROFILE;
+#endif /* DEPLOY_DIN_CODEC_SECC_ONLY */
 				break;
 			case 32:
+#if DEPLOY_DIN_CODEC_SECC_ONLY == SUPPORT_NO
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}Entry) */
 				errn = decode_dinEntryType(stream, &exiDoc->Entry);
 				exiDoc->Entry_isUsed = 1u;
+#else
+				errn = EXI_ERROR_NOT_IN_DEPLOYMENT_PROFILE;
+#endif /* DEPLOY_DIN_CODEC_SECC_ONLY */
 				break;
 			case 33:
+#if DEPLOY_DIN_CODEC_SECC_ONLY == SUPPORT_NO
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}KeyInfo) */
 				errn = decode_dinKeyInfoType(stream, &exiDoc->KeyInfo);
 				exiDoc->KeyInfo_isUsed = 1u;
+#else
+				errn = EXI_ERROR_NOT_IN_DEPLOYMENT_PROFILE;
+#endif /* DEPLOY_DIN_CODEC_SECC_ONLY */
 				break;
 			case 34:
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}KeyName) */
@@ -14336,24 +14553,40 @@ int decode_dinExiDocument(bitstream_t* stream, struct dinEXIDocument* exiDoc) {
 				}
 				break;
 			case 35:
+#if DEPLOY_DIN_CODEC_SECC_ONLY == SUPPORT_NO
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}KeyValue) */
 				errn = decode_dinKeyValueType(stream, &exiDoc->KeyValue);
 				exiDoc->KeyValue_isUsed = 1u;
+#else
+				errn = EXI_ERROR_NOT_IN_DEPLOYMENT_PROFILE;
+#endif /* DEPLOY_DIN_CODEC_SECC_ONLY */
 				break;
 			case 36:
+#if DEPLOY_DIN_CODEC_SECC_ONLY == SUPPORT_NO
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Manifest) */
 				errn = decode_dinManifestType(stream, &exiDoc->Manifest);
 				exiDoc->Manifest_isUsed = 1u;
+#else
+				errn = EXI_ERROR_NOT_IN_DEPLOYMENT_PROFILE;
+#endif /* DEPLOY_DIN_CODEC_SECC_ONLY */
 				break;
 			case 37:
+#if DEPLOY_DIN_CODEC_SECC_ONLY == SUPPORT_NO
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}MeteringReceiptReq) */
 				errn = decode_dinMeteringReceiptReqType(stream, &exiDoc->MeteringReceiptReq);
 				exiDoc->MeteringReceiptReq_isUsed = 1u;
+#else
+				errn = EXI_ERROR_NOT_IN_DEPLOYMENT_PROFILE;
+#endif /* DEPLOY_DIN_CODEC_SECC_ONLY */
 				break;
 			case 38:
+#if DEPLOY_DIN_CODEC_SECC_ONLY == SUPPORT_NO
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}MeteringReceiptRes) */
 				errn = decode_dinMeteringReceiptResType(stream, &exiDoc->MeteringReceiptRes);
 				exiDoc->MeteringReceiptRes_isUsed = 1u;
+#else
+				errn = EXI_ERROR_NOT_IN_DEPLOYMENT_PROFILE;
+#endif /* DEPLOY_DIN_CODEC_SECC_ONLY */
 				break;
 			case 39:
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}MgmtData) */
@@ -14379,189 +14612,337 @@ int decode_dinExiDocument(bitstream_t* stream, struct dinEXIDocument* exiDoc) {
 				}
 				break;
 			case 40:
+#if DEPLOY_DIN_CODEC_SECC_ONLY == SUPPORT_NO
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Object) */
 				errn = decode_dinObjectType(stream, &exiDoc->Object);
 				exiDoc->Object_isUsed = 1u;
+#else
+				errn = EXI_ERROR_NOT_IN_DEPLOYMENT_PROFILE;
+#endif /* DEPLOY_DIN_CODEC_SECC_ONLY */
 				break;
 			case 41:
+#if DEPLOY_DIN_CODEC_SECC_ONLY == SUPPORT_NO
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}PGPData) */
 				errn = decode_dinPGPDataType(stream, &exiDoc->PGPData);
 				exiDoc->PGPData_isUsed = 1u;
+#else
+				errn = EXI_ERROR_NOT_IN_DEPLOYMENT_PROFILE;
+#endif /* DEPLOY_DIN_CODEC_SECC_ONLY */
 				break;
 			case 42:
+#if DEPLOY_DIN_CODEC_SECC_ONLY == SUPPORT_NO
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}PMaxScheduleEntry) */
 				errn = decode_dinPMaxScheduleEntryType(stream, &exiDoc->PMaxScheduleEntry);
 				exiDoc->PMaxScheduleEntry_isUsed = 1u;
+#else
+				errn = EXI_ERROR_NOT_IN_DEPLOYMENT_PROFILE;
+#endif /* DEPLOY_DIN_CODEC_SECC_ONLY */
 				break;
 			case 43:
+#if DEPLOY_DIN_CODEC_SECC_ONLY == SUPPORT_NO
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}PaymentDetailsReq) */
 				errn = decode_dinPaymentDetailsReqType(stream, &exiDoc->PaymentDetailsReq);
 				exiDoc->PaymentDetailsReq_isUsed = 1u;
+#else
+				errn = EXI_ERROR_NOT_IN_DEPLOYMENT_PROFILE;
+#endif /* DEPLOY_DIN_CODEC_SECC_ONLY */
 				break;
 			case 44:
+#if DEPLOY_DIN_CODEC_SECC_ONLY == SUPPORT_NO
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}PaymentDetailsRes) */
 				errn = decode_dinPaymentDetailsResType(stream, &exiDoc->PaymentDetailsRes);
 				exiDoc->PaymentDetailsRes_isUsed = 1u;
+#else
+				errn = EXI_ERROR_NOT_IN_DEPLOYMENT_PROFILE;
+#endif /* DEPLOY_DIN_CODEC_SECC_ONLY */
 				break;
 			case 45:
+#if DEPLOY_DIN_CODEC_SECC_ONLY == SUPPORT_NO
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}PowerDeliveryReq) */
 				errn = decode_dinPowerDeliveryReqType(stream, &exiDoc->PowerDeliveryReq);
 				exiDoc->PowerDeliveryReq_isUsed = 1u;
+#else
+				errn = EXI_ERROR_NOT_IN_DEPLOYMENT_PROFILE;
+#endif /* DEPLOY_DIN_CODEC_SECC_ONLY */
 				break;
 			case 46:
+#if DEPLOY_DIN_CODEC_SECC_ONLY == SUPPORT_NO
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}PowerDeliveryRes) */
 				errn = decode_dinPowerDeliveryResType(stream, &exiDoc->PowerDeliveryRes);
 				exiDoc->PowerDeliveryRes_isUsed = 1u;
+#else
+				errn = EXI_ERROR_NOT_IN_DEPLOYMENT_PROFILE;
+#endif /* DEPLOY_DIN_CODEC_SECC_ONLY */
 				break;
 			case 47:
+#if DEPLOY_DIN_CODEC_SECC_ONLY == SUPPORT_NO
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}PreChargeReq) */
 				errn = decode_dinPreChargeReqType(stream, &exiDoc->PreChargeReq);
 				exiDoc->PreChargeReq_isUsed = 1u;
+#else
+				errn = EXI_ERROR_NOT_IN_DEPLOYMENT_PROFILE;
+#endif /* DEPLOY_DIN_CODEC_SECC_ONLY */
 				break;
 			case 48:
+#if DEPLOY_DIN_CODEC_SECC_ONLY == SUPPORT_NO
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}PreChargeRes) */
 				errn = decode_dinPreChargeResType(stream, &exiDoc->PreChargeRes);
 				exiDoc->PreChargeRes_isUsed = 1u;
+#else
+				errn = EXI_ERROR_NOT_IN_DEPLOYMENT_PROFILE;
+#endif /* DEPLOY_DIN_CODEC_SECC_ONLY */
 				break;
 			case 49:
+#if DEPLOY_DIN_CODEC_SECC_ONLY == SUPPORT_NO
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}RSAKeyValue) */
 				errn = decode_dinRSAKeyValueType(stream, &exiDoc->RSAKeyValue);
 				exiDoc->RSAKeyValue_isUsed = 1u;
+#else
+				errn = EXI_ERROR_NOT_IN_DEPLOYMENT_PROFILE;
+#endif /* DEPLOY_DIN_CODEC_SECC_ONLY */
 				break;
 			case 50:
+#if DEPLOY_DIN_CODEC_SECC_ONLY == SUPPORT_NO
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Reference) */
 				errn = decode_dinReferenceType(stream, &exiDoc->Reference);
 				exiDoc->Reference_isUsed = 1u;
+#else
+				errn = EXI_ERROR_NOT_IN_DEPLOYMENT_PROFILE;
+#endif /* DEPLOY_DIN_CODEC_SECC_ONLY */
 				break;
 			case 51:
+#if DEPLOY_DIN_CODEC_SECC_ONLY == SUPPORT_NO
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}RelativeTimeInterval) */
 				errn = decode_dinRelativeTimeIntervalType(stream, &exiDoc->RelativeTimeInterval);
 				exiDoc->RelativeTimeInterval_isUsed = 1u;
+#else
+				errn = EXI_ERROR_NOT_IN_DEPLOYMENT_PROFILE;
+#endif /* DEPLOY_DIN_CODEC_SECC_ONLY */
 				break;
 			case 52:
+#if DEPLOY_DIN_CODEC_SECC_ONLY == SUPPORT_NO
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}RetrievalMethod) */
 				errn = decode_dinRetrievalMethodType(stream, &exiDoc->RetrievalMethod);
 				exiDoc->RetrievalMethod_isUsed = 1u;
+#else
+				errn = EXI_ERROR_NOT_IN_DEPLOYMENT_PROFILE;
+#endif /* DEPLOY_DIN_CODEC_SECC_ONLY */
 				break;
 			case 53:
+#if DEPLOY_DIN_CODEC_SECC_ONLY == SUPPORT_NO
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}SAScheduleList) */
 				errn = decode_dinSAScheduleListType(stream, &exiDoc->SAScheduleList);
 				exiDoc->SAScheduleList_isUsed = 1u;
+#else
+				errn = EXI_ERROR_NOT_IN_DEPLOYMENT_PROFILE;
+#endif /* DEPLOY_DIN_CODEC_SECC_ONLY */
 				break;
 			case 54:
+#if DEPLOY_DIN_CODEC_SECC_ONLY == SUPPORT_NO
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}SASchedules) */
 				errn = decode_dinSASchedulesType(stream, &exiDoc->SASchedules);
 				exiDoc->SASchedules_isUsed = 1u;
+#else
+				errn = EXI_ERROR_NOT_IN_DEPLOYMENT_PROFILE;
+#endif /* DEPLOY_DIN_CODEC_SECC_ONLY */
 				break;
 			case 55:
+#if DEPLOY_DIN_CODEC_SECC_ONLY == SUPPORT_NO
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}SPKIData) */
 				errn = decode_dinSPKIDataType(stream, &exiDoc->SPKIData);
 				exiDoc->SPKIData_isUsed = 1u;
+#else
+				errn = EXI_ERROR_NOT_IN_DEPLOYMENT_PROFILE;
+#endif /* DEPLOY_DIN_CODEC_SECC_ONLY */
 				break;
 			case 56:
+#if DEPLOY_DIN_CODEC_SECC_ONLY == SUPPORT_NO
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}SalesTariffEntry) */
 				errn = decode_dinSalesTariffEntryType(stream, &exiDoc->SalesTariffEntry);
 				exiDoc->SalesTariffEntry_isUsed = 1u;
+#else
+				errn = EXI_ERROR_NOT_IN_DEPLOYMENT_PROFILE;
+#endif /* DEPLOY_DIN_CODEC_SECC_ONLY */
 				break;
 			case 57:
+#if DEPLOY_DIN_CODEC_SECC_ONLY == SUPPORT_NO
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}ServiceCharge) */
 				errn = decode_dinServiceChargeType(stream, &exiDoc->ServiceCharge);
 				exiDoc->ServiceCharge_isUsed = 1u;
+#else
+				errn = EXI_ERROR_NOT_IN_DEPLOYMENT_PROFILE;
+#endif /* DEPLOY_DIN_CODEC_SECC_ONLY */
 				break;
 			case 58:
+#if DEPLOY_DIN_CODEC_SECC_ONLY == SUPPORT_NO
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ServiceDetailReq) */
 				errn = decode_dinServiceDetailReqType(stream, &exiDoc->ServiceDetailReq);
 				exiDoc->ServiceDetailReq_isUsed = 1u;
+#else
+				errn = EXI_ERROR_NOT_IN_DEPLOYMENT_PROFILE;
+#endif /* DEPLOY_DIN_CODEC_SECC_ONLY */
 				break;
 			case 59:
+#if DEPLOY_DIN_CODEC_SECC_ONLY == SUPPORT_NO
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ServiceDetailRes) */
 				errn = decode_dinServiceDetailResType(stream, &exiDoc->ServiceDetailRes);
 				exiDoc->ServiceDetailRes_isUsed = 1u;
+#else
+				errn = EXI_ERROR_NOT_IN_DEPLOYMENT_PROFILE;
+#endif /* DEPLOY_DIN_CODEC_SECC_ONLY */
 				break;
 			case 60:
+#if DEPLOY_DIN_CODEC_SECC_ONLY == SUPPORT_NO
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ServiceDiscoveryReq) */
 				errn = decode_dinServiceDiscoveryReqType(stream, &exiDoc->ServiceDiscoveryReq);
 				exiDoc->ServiceDiscoveryReq_isUsed = 1u;
+#else
+				errn = EXI_ERROR_NOT_IN_DEPLOYMENT_PROFILE;
+#endif /* DEPLOY_DIN_CODEC_SECC_ONLY */
 				break;
 			case 61:
+#if DEPLOY_DIN_CODEC_SECC_ONLY == SUPPORT_NO
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ServiceDiscoveryRes) */
 				errn = decode_dinServiceDiscoveryResType(stream, &exiDoc->ServiceDiscoveryRes);
 				exiDoc->ServiceDiscoveryRes_isUsed = 1u;
+#else
+				errn = EXI_ERROR_NOT_IN_DEPLOYMENT_PROFILE;
+#endif /* DEPLOY_DIN_CODEC_SECC_ONLY */
 				break;
 			case 62:
+#if DEPLOY_DIN_CODEC_SECC_ONLY == SUPPORT_NO
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ServicePaymentSelectionReq) */
 				errn = decode_dinServicePaymentSelectionReqType(stream, &exiDoc->ServicePaymentSelectionReq);
 				exiDoc->ServicePaymentSelectionReq_isUsed = 1u;
+#else
+				errn = EXI_ERROR_NOT_IN_DEPLOYMENT_PROFILE;
+#endif /* DEPLOY_DIN_CODEC_SECC_ONLY */
 				break;
 			case 63:
+#if DEPLOY_DIN_CODEC_SECC_ONLY == SUPPORT_NO
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}ServicePaymentSelectionRes) */
 				errn = decode_dinServicePaymentSelectionResType(stream, &exiDoc->ServicePaymentSelectionRes);
 				exiDoc->ServicePaymentSelectionRes_isUsed = 1u;
+#else
+				errn = EXI_ERROR_NOT_IN_DEPLOYMENT_PROFILE;
+#endif /* DEPLOY_DIN_CODEC_SECC_ONLY */
 				break;
 			case 64:
+#if DEPLOY_DIN_CODEC_SECC_ONLY == SUPPORT_NO
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}SessionSetupReq) */
 				errn = decode_dinSessionSetupReqType(stream, &exiDoc->SessionSetupReq);
 				exiDoc->SessionSetupReq_isUsed = 1u;
+#else
+				errn = EXI_ERROR_NOT_IN_DEPLOYMENT_PROFILE;
+#endif /* DEPLOY_DIN_CODEC_SECC_ONLY */
 				break;
 			case 65:
+#if DEPLOY_DIN_CODEC_SECC_ONLY == SUPPORT_NO
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}SessionSetupRes) */
 				errn = decode_dinSessionSetupResType(stream, &exiDoc->SessionSetupRes);
 				exiDoc->SessionSetupRes_isUsed = 1u;
+#else
+				errn = EXI_ERROR_NOT_IN_DEPLOYMENT_PROFILE;
+#endif /* DEPLOY_DIN_CODEC_SECC_ONLY */
 				break;
 			case 66:
+#if DEPLOY_DIN_CODEC_SECC_ONLY == SUPPORT_NO
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}SessionStopReq) */
 				errn = decode_dinSessionStopType(stream, &exiDoc->SessionStopReq);
 				exiDoc->SessionStopReq_isUsed = 1u;
+#else
+				errn = EXI_ERROR_NOT_IN_DEPLOYMENT_PROFILE;
+#endif /* DEPLOY_DIN_CODEC_SECC_ONLY */
 				break;
 			case 67:
+#if DEPLOY_DIN_CODEC_SECC_ONLY == SUPPORT_NO
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}SessionStopRes) */
 				errn = decode_dinSessionStopResType(stream, &exiDoc->SessionStopRes);
 				exiDoc->SessionStopRes_isUsed = 1u;
+#else
+				errn = EXI_ERROR_NOT_IN_DEPLOYMENT_PROFILE;
+#endif /* DEPLOY_DIN_CODEC_SECC_ONLY */
 				break;
 			case 68:
+#if DEPLOY_DIN_CODEC_SECC_ONLY == SUPPORT_NO
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Signature) */
 				errn = decode_dinSignatureType(stream, &exiDoc->Signature);
 				exiDoc->Signature_isUsed = 1u;
+#else
+				errn = EXI_ERROR_NOT_IN_DEPLOYMENT_PROFILE;
+#endif /* DEPLOY_DIN_CODEC_SECC_ONLY */
 				break;
 			case 69:
+#if DEPLOY_DIN_CODEC_SECC_ONLY == SUPPORT_NO
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}SignatureMethod) */
 				errn = decode_dinSignatureMethodType(stream, &exiDoc->SignatureMethod);
 				exiDoc->SignatureMethod_isUsed = 1u;
+#else
+				errn = EXI_ERROR_NOT_IN_DEPLOYMENT_PROFILE;
+#endif /* DEPLOY_DIN_CODEC_SECC_ONLY */
 				break;
 			case 70:
+#if DEPLOY_DIN_CODEC_SECC_ONLY == SUPPORT_NO
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}SignatureProperties) */
 				errn = decode_dinSignaturePropertiesType(stream, &exiDoc->SignatureProperties);
 				exiDoc->SignatureProperties_isUsed = 1u;
+#else
+				errn = EXI_ERROR_NOT_IN_DEPLOYMENT_PROFILE;
+#endif /* DEPLOY_DIN_CODEC_SECC_ONLY */
 				break;
 			case 71:
+#if DEPLOY_DIN_CODEC_SECC_ONLY == SUPPORT_NO
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}SignatureProperty) */
 				errn = decode_dinSignaturePropertyType(stream, &exiDoc->SignatureProperty);
 				exiDoc->SignatureProperty_isUsed = 1u;
+#else
+				errn = EXI_ERROR_NOT_IN_DEPLOYMENT_PROFILE;
+#endif /* DEPLOY_DIN_CODEC_SECC_ONLY */
 				break;
 			case 72:
+#if DEPLOY_DIN_CODEC_SECC_ONLY == SUPPORT_NO
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}SignatureValue) */
 				errn = decode_dinSignatureValueType(stream, &exiDoc->SignatureValue);
 				exiDoc->SignatureValue_isUsed = 1u;
+#else
+				errn = EXI_ERROR_NOT_IN_DEPLOYMENT_PROFILE;
+#endif /* DEPLOY_DIN_CODEC_SECC_ONLY */
 				break;
 			case 73:
+#if DEPLOY_DIN_CODEC_SECC_ONLY == SUPPORT_NO
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}SignedInfo) */
 				errn = decode_dinSignedInfoType(stream, &exiDoc->SignedInfo);
 				exiDoc->SignedInfo_isUsed = 1u;
+#else
+				errn = EXI_ERROR_NOT_IN_DEPLOYMENT_PROFILE;
+#endif /* DEPLOY_DIN_CODEC_SECC_ONLY */
 				break;
 			case 74:
+#if DEPLOY_DIN_CODEC_SECC_ONLY == SUPPORT_NO
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgDataTypes}TimeInterval) */
 				errn = decode_dinIntervalType(stream, &exiDoc->TimeInterval);
 				exiDoc->TimeInterval_isUsed = 1u;
+#else
+				errn = EXI_ERROR_NOT_IN_DEPLOYMENT_PROFILE;
+#endif /* DEPLOY_DIN_CODEC_SECC_ONLY */
 				break;
 			case 75:
+#if DEPLOY_DIN_CODEC_SECC_ONLY == SUPPORT_NO
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Transform) */
 				errn = decode_dinTransformType(stream, &exiDoc->Transform);
 				exiDoc->Transform_isUsed = 1u;
+#else
+				errn = EXI_ERROR_NOT_IN_DEPLOYMENT_PROFILE;
+#endif /* DEPLOY_DIN_CODEC_SECC_ONLY */
 				break;
 			case 76:
+#if DEPLOY_DIN_CODEC_SECC_ONLY == SUPPORT_NO
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}Transforms) */
 				errn = decode_dinTransformsType(stream, &exiDoc->Transforms);
 				exiDoc->Transforms_isUsed = 1u;
+#else
+				errn = EXI_ERROR_NOT_IN_DEPLOYMENT_PROFILE;
+#endif /* DEPLOY_DIN_CODEC_SECC_ONLY */
 				break;
 			case 77:
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgDef}V2G_Message) */
@@ -14569,19 +14950,31 @@ int decode_dinExiDocument(bitstream_t* stream, struct dinEXIDocument* exiDoc) {
 				exiDoc->V2G_Message_isUsed = 1u;
 				break;
 			case 78:
+#if DEPLOY_DIN_CODEC_SECC_ONLY == SUPPORT_NO
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}WeldingDetectionReq) */
 				errn = decode_dinWeldingDetectionReqType(stream, &exiDoc->WeldingDetectionReq);
 				exiDoc->WeldingDetectionReq_isUsed = 1u;
+#else
+				errn = EXI_ERROR_NOT_IN_DEPLOYMENT_PROFILE;
+#endif /* DEPLOY_DIN_CODEC_SECC_ONLY */
 				break;
 			case 79:
+#if DEPLOY_DIN_CODEC_SECC_ONLY == SUPPORT_NO
 				/* START_ELEMENT({urn:iso:15118:2:2010:MsgBody}WeldingDetectionRes) */
 				errn = decode_dinWeldingDetectionResType(stream, &exiDoc->WeldingDetectionRes);
 				exiDoc->WeldingDetectionRes_isUsed = 1u;
+#else
+				errn = EXI_ERROR_NOT_IN_DEPLOYMENT_PROFILE;
+#endif /* DEPLOY_DIN_CODEC_SECC_ONLY */
 				break;
 			case 80:
+#if DEPLOY_DIN_CODEC_SECC_ONLY == SUPPORT_NO
 				/* START_ELEMENT({http://www.w3.org/2000/09/xmldsig#}X509Data) */
 				errn = decode_dinX509DataType(stream, &exiDoc->X509Data);
 				exiDoc->X509Data_isUsed = 1u;
+#else
+				errn = EXI_ERROR_NOT_IN_DEPLOYMENT_PROFILE;
+#endif /* DEPLOY_DIN_CODEC_SECC_ONLY */
 				break;
 			default:
 				errn = EXI_ERROR_UNEXPECTED_EVENT_LEVEL1;
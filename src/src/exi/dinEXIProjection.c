@@ -0,0 +1,670 @@
+/*
+ * Field projection decoder for the DIN 70121 messages the SECC reads.
+ * See dinEXIProjection.h. The grammar IDs in the comments follow the generated
+ * dinEXIDatatypesDecoder.c, so both decoders can be compared state by state.
+ */
+
+#include "dinEXIProjection.h"
+#include "DecoderChannel.h"
+#include "EXIHeaderDecoder.h"
+
+#include <string.h>
+
+#if DEPLOY_DIN_CODEC == SUPPORT_YES
+
+/* event code of the V2G_Message in the document content, and of the ChargeParameterDiscoveryReq in the body */
+#define DIN_PROJ_DOC_V2G_MESSAGE 77
+#define DIN_PROJ_BODY_EVENT_CHARGEPARAMETERDISCOVERYREQ 7
+
+
+/* Reads an event code which must have the value 'expected' */
+static int decodeExpectedEvent(bitstream_t* stream, size_t nbits, uint32_t expected, int errnOther) {
+	uint32_t eventCode;
+	int errn = decodeNBitUnsignedInteger(stream, nbits, &eventCode);
+	if (errn == 0 && eventCode != expected) {
+		errn = errnOther;
+	}
+	return errn;
+}
+
+/* FirstStartTag[CHARACTERS] of a simple element */
+static int decodeSimpleStart(bitstream_t* stream) {
+	return decodeExpectedEvent(stream, 1, 0, EXI_UNSUPPORTED_EVENT_CODE_CHARACTERISTICS);
+}
+
+/* valid EE for simple element */
+static int decodeSimpleEnd(bitstream_t* stream) {
+	return decodeExpectedEvent(stream, 1, 0, EXI_DEVIANT_SUPPORT_NOT_DEPLOYED);
+}
+
+/* Element[END_ELEMENT] of a complex element */
+static int decodeEndElement(bitstream_t* stream) {
+	return decodeExpectedEvent(stream, 1, 0, EXI_ERROR_UNKOWN_EVENT_CODE);
+}
+
+/* Content of a simple element with an n-bit integer or enumeration value */
+static int decodeSimpleNBit(bitstream_t* stream, size_t nbits, uint32_t* uint32) {
+	int errn = decodeSimpleStart(stream);
+	if (errn == 0) {
+		errn = decodeNBitUnsignedInteger(stream, nbits, uint32);
+	}
+	if (errn == 0) {
+		errn = decodeSimpleEnd(stream);
+	}
+	return errn;
+}
+
+/* Content of a simple element with a boolean value */
+static int decodeSimpleBoolean(bitstream_t* stream, int* b) {
+	int errn = decodeSimpleStart(stream);
+	if (errn == 0) {
+		errn = decodeBoolean(stream, b);
+	}
+	if (errn == 0) {
+		errn = decodeSimpleEnd(stream);
+	}
+	return errn;
+}
+
+/* PhysicalValueType, grammars 198..200. pv == NULL drops the value. */
+static int decode_dinProjectedPhysicalValue(bitstream_t* stream, struct dinProjectedPhysicalValue* pv) {
+	uint32_t uint32 = 0;
+	uint32_t eventCode;
+	int16_t value = 0;
+	int8_t multiplier;
+	uint8_t unit = DIN_PROJ_UNIT_NOT_USED;
+	int errn;
+
+	/* FirstStartTag[START_ELEMENT(Multiplier)] */
+	errn = decodeExpectedEvent(stream, 1, 0, EXI_ERROR_UNKOWN_EVENT_CODE);
+	if (errn == 0) {
+		errn = decodeSimpleNBit(stream, 3, &uint32);
+	}
+	multiplier = (int8_t)(uint32 - 3);
+	/* Element[START_ELEMENT(Unit), START_ELEMENT(Value)] */
+	if (errn == 0) {
+		errn = decodeNBitUnsignedInteger(stream, 2, &eventCode);
+	}
+	if (errn == 0) {
+		if (eventCode == 0) {
+			errn = decodeSimpleNBit(stream, 4, &uint32);
+			unit = (uint8_t)uint32;
+			/* Element[START_ELEMENT(Value)] */
+			if (errn == 0) {
+				errn = decodeExpectedEvent(stream, 1, 0, EXI_ERROR_UNKOWN_EVENT_CODE);
+			}
+		} else if (eventCode != 1) {
+			errn = EXI_ERROR_UNKOWN_EVENT_CODE;
+		}
+	}
+	if (errn == 0) {
+		errn = decodeSimpleStart(stream);
+	}
+	if (errn == 0) {
+		errn = decodeInteger16(stream, &value);
+	}
+	if (errn == 0) {
+		errn = decodeSimpleEnd(stream);
+	}
+	if (errn == 0) {
+		errn = decodeEndElement(stream);
+	}
+	if (errn == 0 && pv != NULL) {
+		pv->Value = value;
+		pv->Multiplier = multiplier;
+		pv->Unit = unit;
+	}
+	return errn;
+}
+
+/* Decodes a PhysicalValueType into 'target' if 'field' is selected, otherwise drops it */
+static int decodeProjectedPhysicalValueField(bitstream_t* stream, uint16_t fields, uint16_t field,
+		struct dinProjectedChargeParameterDiscoveryReq* msg, struct dinProjectedPhysicalValue* target) {
+	int errn = decode_dinProjectedPhysicalValue(stream, (fields & field) ? target : NULL);
+	msg->fieldsUsed |= (uint16_t)(fields & field);
+	return errn;
+}
+
+/* MessageHeaderType, grammars 108..110. Keeps the SessionID, drops a Notification. */
+static int decode_dinProjectedMessageHeader(bitstream_t* stream, struct dinProjectedDocument* projDoc) {
+	int grammarID = 108;
+	int done = 0;
+	int errn = 0;
+	uint32_t eventCode;
+	uint32_t uint32;
+	uint16_t len, i;
+
+	while(!done) {
+		switch(grammarID) {
+		case 108:
+			/* FirstStartTag[START_ELEMENT(SessionID)] */
+			errn = decodeExpectedEvent(stream, 1, 0, EXI_ERROR_UNKOWN_EVENT_CODE);
+			if (errn == 0) {
+				errn = decodeSimpleStart(stream);
+			}
+			if (errn == 0) {
+				errn = decodeUnsignedInteger16(stream, &projDoc->SessionIDLen);
+			}
+			if (errn == 0) {
+				errn = (projDoc->SessionIDLen <= dinMessageHeaderType_SessionID_BYTES_SIZE) ? 0 : EXI_ERROR_OUT_OF_BYTE_BUFFER;
+			}
+			if (errn == 0) {
+				errn = decodeBytes(stream, projDoc->SessionIDLen, projDoc->SessionID);
+			}
+			if (errn == 0) {
+				errn = decodeSimpleEnd(stream);
+			}
+			grammarID = 109;
+			break;
+		case 109:
+			/* Element[START_ELEMENT(Notification), START_ELEMENT(Signature), END_ELEMENT] */
+			errn = decodeNBitUnsignedInteger(stream, 2, &eventCode);
+			if (errn == 0) {
+				switch(eventCode) {
+				case 0:
+					/* NotificationType, grammars 268, 269: FaultCode, then an optional FaultMsg */
+					errn = decodeExpectedEvent(stream, 1, 0, EXI_ERROR_UNKOWN_EVENT_CODE);
+					if (errn == 0) {
+						errn = decodeSimpleNBit(stream, 2, &uint32);
+					}
+					if (errn == 0) {
+						errn = decodeNBitUnsignedInteger(stream, 2, &eventCode);
+					}
+					if (errn == 0 && eventCode == 0) {
+						errn = decodeSimpleStart(stream);
+						if (errn == 0) {
+							errn = decodeUnsignedInteger16(stream, &len);
+						}
+						if (errn == 0) {
+							if (len >= 2) {
+								/* string table miss, drop the characters */
+								for (i = 0; i < len - 2 && errn == 0; i++) {
+									errn = decodeUnsignedInteger32(stream, &uint32);
+								}
+							} else {
+								/* string table hit */
+								errn = EXI_ERROR_STRINGVALUES_NOT_SUPPORTED;
+							}
+						}
+						if (errn == 0) {
+							errn = decodeSimpleEnd(stream);
+						}
+						if (errn == 0) {
+							errn = decodeEndElement(stream);
+						}
+					} else if (errn == 0 && eventCode != 1) {
+						errn = EXI_ERROR_UNKOWN_EVENT_CODE;
+					}
+					grammarID = 110;
+					break;
+				case 1:
+					/* a signed message is not handled by the SECC */
+					errn = EXI_ERROR_NOT_IN_DEPLOYMENT_PROFILE;
+					break;
+				case 2:
+					done = 1;
+					break;
+				default:
+					errn = EXI_ERROR_UNKOWN_EVENT_CODE;
+					break;
+				}
+			}
+			break;
+		case 110:
+			/* Element[START_ELEMENT(Signature), END_ELEMENT] */
+			errn = decodeNBitUnsignedInteger(stream, 2, &eventCode);
+			if (errn == 0) {
+				switch(eventCode) {
+				case 0:
+					errn = EXI_ERROR_NOT_IN_DEPLOYMENT_PROFILE;
+					break;
+				case 1:
+					done = 1;
+					break;
+				default:
+					errn = EXI_ERROR_UNKOWN_EVENT_CODE;
+					break;
+				}
+			}
+			break;
+		default:
+			errn = EXI_ERROR_UNKOWN_GRAMMAR_ID;
+			break;
+		}
+		if(errn) {
+			done = 1;
+		}
+	}
+	return errn;
+}
+
+/* DC_EVStatusType, grammars 193..197 */
+static int decode_dinProjectedDC_EVStatus(bitstream_t* stream, uint16_t fields, struct dinProjectedChargeParameterDiscoveryReq* msg) {
+	int grammarID = 193;
+	int done = 0;
+	int errn = 0;
+	uint32_t eventCode;
+	uint32_t uint32 = 0;
+	int b = 0;
+
+	while(!done) {
+		switch(grammarID) {
+		case 193:
+			/* FirstStartTag[START_ELEMENT(EVReady)] */
+			errn = decodeExpectedEvent(stream, 1, 0, EXI_ERROR_UNKOWN_EVENT_CODE);
+			if (errn == 0) {
+				errn = decodeSimpleBoolean(stream, &b);
+			}
+			if (fields & DIN_PROJ_CPD_EVREADY) {
+				msg->EVReady = (uint8_t)b;
+				msg->fieldsUsed |= DIN_PROJ_CPD_EVREADY;
+			}
+			grammarID = 194;
+			break;
+		case 194:
+			/* Element[START_ELEMENT(EVCabinConditioning), START_ELEMENT(EVRESSConditioning), START_ELEMENT(EVErrorCode)] */
+			errn = decodeNBitUnsignedInteger(stream, 2, &eventCode);
+			if (errn == 0) {
+				switch(eventCode) {
+				case 0:
+					errn = decodeSimpleBoolean(stream, &b);
+					grammarID = 195;
+					break;
+				case 1:
+					errn = decodeSimpleBoolean(stream, &b);
+					grammarID = 196;
+					break;
+				case 2:
+					grammarID = 197;
+					errn = decodeSimpleNBit(stream, 4, &uint32);
+					if (fields & DIN_PROJ_CPD_EVERRORCODE) {
+						msg->EVErrorCode = (uint8_t)uint32;
+						msg->fieldsUsed |= DIN_PROJ_CPD_EVERRORCODE;
+					}
+					break;
+				default:
+					errn = EXI_ERROR_UNKOWN_EVENT_CODE;
+					break;
+				}
+			}
+			break;
+		case 195:
+			/* Element[START_ELEMENT(EVRESSConditioning), START_ELEMENT(EVErrorCode)] */
+			errn = decodeNBitUnsignedInteger(stream, 2, &eventCode);
+			if (errn == 0) {
+				switch(eventCode) {
+				case 0:
+					errn = decodeSimpleBoolean(stream, &b);
+					grammarID = 196;
+					break;
+				case 1:
+					grammarID = 197;
+					errn = decodeSimpleNBit(stream, 4, &uint32);
+					if (fields & DIN_PROJ_CPD_EVERRORCODE) {
+						msg->EVErrorCode = (uint8_t)uint32;
+						msg->fieldsUsed |= DIN_PROJ_CPD_EVERRORCODE;
+					}
+					break;
+				default:
+					errn = EXI_ERROR_UNKOWN_EVENT_CODE;
+					break;
+				}
+			}
+			break;
+		case 196:
+			/* Element[START_ELEMENT(EVErrorCode)] */
+			errn = decodeExpectedEvent(stream, 1, 0, EXI_ERROR_UNKOWN_EVENT_CODE);
+			if (errn == 0) {
+				errn = decodeSimpleNBit(stream, 4, &uint32);
+			}
+			if (fields & DIN_PROJ_CPD_EVERRORCODE) {
+				msg->EVErrorCode = (uint8_t)uint32;
+				msg->fieldsUsed |= DIN_PROJ_CPD_EVERRORCODE;
+			}
+			grammarID = 197;
+			break;
+		case 197:
+			/* Element[START_ELEMENT(EVRESSSOC)] */
+			errn = decodeExpectedEvent(stream, 1, 0, EXI_ERROR_UNKOWN_EVENT_CODE);
+			if (errn == 0) {
+				errn = decodeSimpleNBit(stream, 7, &uint32);
+			}
+			if (fields & DIN_PROJ_CPD_EVRESSSOC) {
+				msg->EVRESSSOC = (int8_t)uint32;
+				msg->fieldsUsed |= DIN_PROJ_CPD_EVRESSSOC;
+			}
+			if (errn == 0) {
+				errn = decodeEndElement(stream);
+			}
+			done = 1;
+			break;
+		default:
+			errn = EXI_ERROR_UNKOWN_GRAMMAR_ID;
+			break;
+		}
+		if(errn) {
+			done = 1;
+		}
+	}
+	return errn;
+}
+
+/* DC_EVChargeParameterType, grammars 65..72 */
+static int decode_dinProjectedDC_EVChargeParameter(bitstream_t* stream, uint16_t fields, struct dinProjectedChargeParameterDiscoveryReq* msg) {
+	int grammarID = 65;
+	int done = 0;
+	int errn = 0;
+	uint32_t eventCode;
+	uint32_t uint32 = 0;
+
+	while(!done) {
+		switch(grammarID) {
+		case 65:
+			/* FirstStartTag[START_ELEMENT(DC_EVStatus)] */
+			errn = decodeExpectedEvent(stream, 1, 0, EXI_ERROR_UNKOWN_EVENT_CODE);
+			if (errn == 0) {
+				errn = decode_dinProjectedDC_EVStatus(stream, fields, msg);
+			}
+			grammarID = 66;
+			break;
+		case 66:
+			/* Element[START_ELEMENT(EVMaximumCurrentLimit)] */
+			errn = decodeExpectedEvent(stream, 1, 0, EXI_ERROR_UNKOWN_EVENT_CODE);
+			if (errn == 0) {
+				errn = decodeProjectedPhysicalValueField(stream, fields, DIN_PROJ_CPD_EVMAXIMUMCURRENTLIMIT, msg, &msg->EVMaximumCurrentLimit);
+			}
+			grammarID = 67;
+			break;
+		case 67:
+			/* Element[START_ELEMENT(EVMaximumPowerLimit), START_ELEMENT(EVMaximumVoltageLimit)] */
+			errn = decodeNBitUnsignedInteger(stream, 2, &eventCode);
+			if (errn == 0) {
+				switch(eventCode) {
+				case 0:
+					errn = decodeProjectedPhysicalValueField(stream, fields, DIN_PROJ_CPD_EVMAXIMUMPOWERLIMIT, msg, &msg->EVMaximumPowerLimit);
+					grammarID = 68;
+					break;
+				case 1:
+					errn = decodeProjectedPhysicalValueField(stream, fields, DIN_PROJ_CPD_EVMAXIMUMVOLTAGELIMIT, msg, &msg->EVMaximumVoltageLimit);
+					grammarID = 69;
+					break;
+				default:
+					errn = EXI_ERROR_UNKOWN_EVENT_CODE;
+					break;
+				}
+			}
+			break;
+		case 68:
+			/* Element[START_ELEMENT(EVMaximumVoltageLimit)] */
+			errn = decodeExpectedEvent(stream, 1, 0, EXI_ERROR_UNKOWN_EVENT_CODE);
+			if (errn == 0) {
+				errn = decodeProjectedPhysicalValueField(stream, fields, DIN_PROJ_CPD_EVMAXIMUMVOLTAGELIMIT, msg, &msg->EVMaximumVoltageLimit);
+			}
+			grammarID = 69;
+			break;
+		case 69:
+			/* Element[START_ELEMENT(EVEnergyCapacity), START_ELEMENT(EVEnergyRequest), START_ELEMENT(FullSOC), START_ELEMENT(BulkSOC), END_ELEMENT] */
+			errn = decodeNBitUnsignedInteger(stream, 3, &eventCode);
+			if (errn == 0) {
+				switch(eventCode) {
+				case 0:
+					errn = decodeProjectedPhysicalValueField(stream, fields, DIN_PROJ_CPD_EVENERGYCAPACITY, msg, &msg->EVEnergyCapacity);
+					grammarID = 70;
+					break;
+				case 1:
+					errn = decodeProjectedPhysicalValueField(stream, fields, DIN_PROJ_CPD_EVENERGYREQUEST, msg, &msg->EVEnergyRequest);
+					grammarID = 71;
+					break;
+				case 2:
+					grammarID = 72;
+					break;
+				case 3:
+					grammarID = 73;
+					break;
+				case 4:
+					done = 1;
+					break;
+				default:
+					errn = EXI_ERROR_UNKOWN_EVENT_CODE;
+					break;
+				}
+			}
+			break;
+		case 70:
+			/* Element[START_ELEMENT(EVEnergyRequest), START_ELEMENT(FullSOC), START_ELEMENT(BulkSOC), END_ELEMENT] */
+			errn = decodeNBitUnsignedInteger(stream, 3, &eventCode);
+			if (errn == 0) {
+				switch(eventCode) {
+				case 0:
+					errn = decodeProjectedPhysicalValueField(stream, fields, DIN_PROJ_CPD_EVENERGYREQUEST, msg, &msg->EVEnergyRequest);
+					grammarID = 71;
+					break;
+				case 1:
+					grammarID = 72;
+					break;
+				case 2:
+					grammarID = 73;
+					break;
+				case 3:
+					done = 1;
+					break;
+				default:
+					errn = EXI_ERROR_UNKOWN_EVENT_CODE;
+					break;
+				}
+			}
+			break;
+		case 71:
+			/* Element[START_ELEMENT(FullSOC), START_ELEMENT(BulkSOC), END_ELEMENT] */
+			errn = decodeNBitUnsignedInteger(stream, 2, &eventCode);
+			if (errn == 0) {
+				switch(eventCode) {
+				case 0:
+					grammarID = 72;
+					break;
+				case 1:
+					grammarID = 73;
+					break;
+				case 2:
+					done = 1;
+					break;
+				default:
+					errn = EXI_ERROR_UNKOWN_EVENT_CODE;
+					break;
+				}
+			}
+			break;
+		case 72:
+			/* content of START_ELEMENT(FullSOC), then Element[START_ELEMENT(BulkSOC), END_ELEMENT] */
+			errn = decodeSimpleNBit(stream, 7, &uint32);
+			if (fields & DIN_PROJ_CPD_FULLSOC) {
+				msg->FullSOC = (int8_t)uint32;
+				msg->fieldsUsed |= DIN_PROJ_CPD_FULLSOC;
+			}
+			if (errn == 0) {
+				errn = decodeNBitUnsignedInteger(stream, 2, &eventCode);
+			}
+			if (errn == 0) {
+				switch(eventCode) {
+				case 0:
+					grammarID = 73;
+					break;
+				case 1:
+					done = 1;
+					break;
+				default:
+					errn = EXI_ERROR_UNKOWN_EVENT_CODE;
+					break;
+				}
+			}
+			break;
+		case 73:
+			/* content of START_ELEMENT(BulkSOC), then Element[END_ELEMENT] (grammar 4 of the generated decoder) */
+			errn = decodeSimpleNBit(stream, 7, &uint32);
+			if (fields & DIN_PROJ_CPD_BULKSOC) {
+				msg->BulkSOC = (int8_t)uint32;
+				msg->fieldsUsed |= DIN_PROJ_CPD_BULKSOC;
+			}
+			if (errn == 0) {
+				errn = decodeEndElement(stream);
+			}
+			done = 1;
+			break;
+		default:
+			errn = EXI_ERROR_UNKOWN_GRAMMAR_ID;
+			break;
+		}
+		if(errn) {
+			done = 1;
+		}
+	}
+	return errn;
+}
+
+/* AC_EVChargeParameterType, grammars 41..45. All elements are mandatory, so this is a plain sequence. */
+static int decode_dinProjectedAC_EVChargeParameter(bitstream_t* stream, uint16_t fields, struct dinProjectedChargeParameterDiscoveryReq* msg) {
+	uint32_t departureTime = 0;
+	int errn;
+
+	/* FirstStartTag[START_ELEMENT(DepartureTime)] */
+	errn = decodeExpectedEvent(stream, 1, 0, EXI_ERROR_UNKOWN_EVENT_CODE);
+	if (errn == 0) {
+		errn = decodeSimpleStart(stream);
+	}
+	if (errn == 0) {
+		errn = decodeUnsignedInteger32(stream, &departureTime);
+	}
+	if (errn == 0) {
+		errn = decodeSimpleEnd(stream);
+	}
+	if (fields & DIN_PROJ_CPD_DEPARTURETIME) {
+		msg->DepartureTime = departureTime;
+		msg->fieldsUsed |= DIN_PROJ_CPD_DEPARTURETIME;
+	}
+	/* Element[START_ELEMENT(EAmount)] */
+	if (errn == 0) {
+		errn = decodeExpectedEvent(stream, 1, 0, EXI_ERROR_UNKOWN_EVENT_CODE);
+	}
+	if (errn == 0) {
+		errn = decodeProjectedPhysicalValueField(stream, fields, DIN_PROJ_CPD_EAMOUNT, msg, &msg->EAmount);
+	}
+	/* Element[START_ELEMENT(EVMaxVoltage)] */
+	if (errn == 0) {
+		errn = decodeExpectedEvent(stream, 1, 0, EXI_ERROR_UNKOWN_EVENT_CODE);
+	}
+	if (errn == 0) {
+		errn = decodeProjectedPhysicalValueField(stream, fields, DIN_PROJ_CPD_EVMAXVOLTAGE, msg, &msg->EVMaxVoltage);
+	}
+	/* Element[START_ELEMENT(EVMaxCurrent)] */
+	if (errn == 0) {
+		errn = decodeExpectedEvent(stream, 1, 0, EXI_ERROR_UNKOWN_EVENT_CODE);
+	}
+	if (errn == 0) {
+		errn = decodeProjectedPhysicalValueField(stream, fields, DIN_PROJ_CPD_EVMAXCURRENT, msg, &msg->EVMaxCurrent);
+	}
+	/* Element[START_ELEMENT(EVMinCurrent)] */
+	if (errn == 0) {
+		errn = decodeExpectedEvent(stream, 1, 0, EXI_ERROR_UNKOWN_EVENT_CODE);
+	}
+	if (errn == 0) {
+		errn = decodeProjectedPhysicalValueField(stream, fields, DIN_PROJ_CPD_EVMINCURRENT, msg, &msg->EVMinCurrent);
+	}
+	if (errn == 0) {
+		errn = decodeEndElement(stream);
+	}
+	return errn;
+}
+
+/* ChargeParameterDiscoveryReqType, grammars 175, 176 */
+static int decode_dinProjectedChargeParameterDiscoveryReq(bitstream_t* stream, uint16_t fields, struct dinProjectedChargeParameterDiscoveryReq* msg) {
+	uint32_t eventCode;
+	uint32_t uint32;
+	int errn;
+
+	/* FirstStartTag[START_ELEMENT(EVRequestedEnergyTransferType)] */
+	errn = decodeExpectedEvent(stream, 1, 0, EXI_ERROR_UNKOWN_EVENT_CODE);
+	if (errn == 0) {
+		errn = decodeSimpleNBit(stream, 3, &uint32);
+	}
+	if (errn == 0 && (fields & DIN_PROJ_CPD_EVREQUESTEDENERGYTRANSFERTYPE)) {
+		msg->EVRequestedEnergyTransferType = (uint8_t)uint32;
+		msg->fieldsUsed |= DIN_PROJ_CPD_EVREQUESTEDENERGYTRANSFERTYPE;
+	}
+	/* Element[START_ELEMENT(AC_EVChargeParameter), START_ELEMENT(DC_EVChargeParameter), START_ELEMENT(EVChargeParameter)] */
+	if (errn == 0) {
+		errn = decodeNBitUnsignedInteger(stream, 2, &eventCode);
+	}
+	if (errn == 0) {
+		switch(eventCode) {
+		case 0:
+			errn = decode_dinProjectedAC_EVChargeParameter(stream, fields, msg);
+			break;
+		case 1:
+			msg->DC_EVChargeParameter_isUsed = 1;
+			errn = decode_dinProjectedDC_EVChargeParameter(stream, fields, msg);
+			break;
+		default:
+			/* the abstract EVChargeParameter is left to the full decoder */
+			errn = EXI_ERROR_NOT_IN_PROJECTION;
+			break;
+		}
+	}
+	if (errn == 0) {
+		errn = decodeEndElement(stream);
+	}
+	return errn;
+}
+
+
+int decode_dinProjectedExiDocument(bitstream_t* stream, uint16_t fields, struct dinProjectedDocument* projDoc) {
+	uint32_t eventCode;
+	int errn;
+
+	memset(projDoc, 0, sizeof(*projDoc));
+	projDoc->bodyElement = DIN_PROJ_BODY_NONE;
+
+	errn = readEXIHeader(stream);
+	/* DocContent[..., START_ELEMENT(V2G_Message), ...] */
+	if (errn == 0) {
+		errn = decodeExpectedEvent(stream, 7, DIN_PROJ_DOC_V2G_MESSAGE, EXI_ERROR_NOT_IN_PROJECTION);
+	}
+	/* V2G_Message grammar 173: FirstStartTag[START_ELEMENT(Header)] */
+	if (errn == 0) {
+		errn = decodeExpectedEvent(stream, 1, 0, EXI_ERROR_UNKOWN_EVENT_CODE);
+	}
+	if (errn == 0) {
+		errn = decode_dinProjectedMessageHeader(stream, projDoc);
+	}
+	/* V2G_Message grammar 174: Element[START_ELEMENT(Body)] */
+	if (errn == 0) {
+		errn = decodeExpectedEvent(stream, 1, 0, EXI_ERROR_UNKOWN_EVENT_CODE);
+	}
+	/* Body grammar 6: one of the body elements */
+	if (errn == 0) {
+		errn = decodeNBitUnsignedInteger(stream, 6, &eventCode);
+	}
+	if (errn == 0) {
+		switch(eventCode) {
+		case DIN_PROJ_BODY_EVENT_CHARGEPARAMETERDISCOVERYREQ:
+			projDoc->bodyElement = DIN_PROJ_BODY_CHARGEPARAMETERDISCOVERYREQ;
+			errn = decode_dinProjectedChargeParameterDiscoveryReq(stream, fields, &projDoc->Body.ChargeParameterDiscoveryReq);
+			break;
+		default:
+			errn = EXI_ERROR_NOT_IN_PROJECTION;
+			break;
+		}
+	}
+	/* END_ELEMENT of the Body, then of the V2G_Message */
+	if (errn == 0) {
+		errn = decodeEndElement(stream);
+	}
+	if (errn == 0) {
+		errn = decodeEndElement(stream);
+	}
+	if (errn == EXI_ERROR_NOT_IN_PROJECTION) {
+		projDoc->bodyElement = DIN_PROJ_BODY_NONE;
+	}
+	return errn;
+}
+
+#endif /* DEPLOY_DIN_CODEC */
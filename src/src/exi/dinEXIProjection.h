@@ -0,0 +1,109 @@
+/*
+ * Field projection decoder for the DIN 70121 messages the SECC reads.
+ *
+ * The generated decode_dinExiDocument() materialises every element of a message into a full
+ * dinEXIDocument (about 18 kByte). The SECC only looks at a handful of values per message,
+ * so for the projected messages the application passes a mask of the fields it wants, and
+ * the decoder writes just those into a compact dinProjectedDocument.
+ *
+ * EXI has no length prefixes, elements which are not requested are still walked through bit
+ * by bit to find the start of the next element, but their values are dropped and never stored.
+ *
+ * A body element which is not projected is not consumed. decode_dinProjectedExiDocument() then
+ * returns EXI_ERROR_NOT_IN_PROJECTION, and the caller decodes the same stream again with the full
+ * decode_dinExiDocument().
+ */
+
+#ifndef EXI_din_PROJECTION_H
+#define EXI_din_PROJECTION_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "dinEXIDatatypes.h"
+
+#if DEPLOY_DIN_CODEC == SUPPORT_YES
+
+#include <stdint.h>
+
+#include "EXITypes.h"
+#include "ErrorCodes.h"
+
+/* Body elements which can be decoded by projection */
+#define DIN_PROJ_BODY_NONE 0
+#define DIN_PROJ_BODY_CHARGEPARAMETERDISCOVERYREQ 1
+
+/* Field selection for ChargeParameterDiscoveryReq */
+#define DIN_PROJ_CPD_EVREQUESTEDENERGYTRANSFERTYPE (1u << 0)
+#define DIN_PROJ_CPD_EVREADY                       (1u << 1)
+#define DIN_PROJ_CPD_EVERRORCODE                   (1u << 2)
+#define DIN_PROJ_CPD_EVRESSSOC                     (1u << 3)
+#define DIN_PROJ_CPD_EVMAXIMUMCURRENTLIMIT         (1u << 4)
+#define DIN_PROJ_CPD_EVMAXIMUMPOWERLIMIT           (1u << 5)
+#define DIN_PROJ_CPD_EVMAXIMUMVOLTAGELIMIT         (1u << 6)
+#define DIN_PROJ_CPD_EVENERGYCAPACITY              (1u << 7)
+#define DIN_PROJ_CPD_EVENERGYREQUEST               (1u << 8)
+#define DIN_PROJ_CPD_FULLSOC                       (1u << 9)
+#define DIN_PROJ_CPD_BULKSOC                       (1u << 10)
+#define DIN_PROJ_CPD_DEPARTURETIME                 (1u << 11) /* AC only */
+#define DIN_PROJ_CPD_EAMOUNT                       (1u << 12) /* AC only */
+#define DIN_PROJ_CPD_EVMAXVOLTAGE                  (1u << 13) /* AC only */
+#define DIN_PROJ_CPD_EVMAXCURRENT                  (1u << 14) /* AC only */
+#define DIN_PROJ_CPD_EVMINCURRENT                  (1u << 15) /* AC only */
+
+/* Unit value of a dinProjectedPhysicalValue when the optional Unit element was absent */
+#define DIN_PROJ_UNIT_NOT_USED 0xFF
+
+struct dinProjectedPhysicalValue {
+	int16_t Value;
+	int8_t Multiplier;
+	uint8_t Unit; /* dinunitSymbolType, or DIN_PROJ_UNIT_NOT_USED */
+};
+
+struct dinProjectedChargeParameterDiscoveryReq {
+	uint16_t fieldsUsed; /* DIN_PROJ_CPD_* bits of the fields which were requested AND present in the message */
+	uint8_t DC_EVChargeParameter_isUsed; /* 1 for a DC_EVChargeParameter, 0 for an AC_EVChargeParameter */
+	uint8_t EVRequestedEnergyTransferType; /* dinEVRequestedEnergyTransferType */
+	uint8_t EVReady;
+	uint8_t EVErrorCode; /* dinDC_EVErrorCodeType */
+	int8_t EVRESSSOC;
+	int8_t FullSOC;
+	int8_t BulkSOC;
+	uint32_t DepartureTime;
+	struct dinProjectedPhysicalValue EVMaximumCurrentLimit;
+	struct dinProjectedPhysicalValue EVMaximumPowerLimit;
+	struct dinProjectedPhysicalValue EVMaximumVoltageLimit;
+	struct dinProjectedPhysicalValue EVEnergyCapacity;
+	struct dinProjectedPhysicalValue EVEnergyRequest;
+	struct dinProjectedPhysicalValue EAmount;
+	struct dinProjectedPhysicalValue EVMaxVoltage;
+	struct dinProjectedPhysicalValue EVMaxCurrent;
+	struct dinProjectedPhysicalValue EVMinCurrent;
+};
+
+struct dinProjectedDocument {
+	uint8_t SessionID[dinMessageHeaderType_SessionID_BYTES_SIZE];
+	uint16_t SessionIDLen;
+	uint8_t bodyElement; /* DIN_PROJ_BODY_* */
+	union {
+		struct dinProjectedChargeParameterDiscoveryReq ChargeParameterDiscoveryReq;
+	} Body;
+};
+
+/**
+ * \brief 	Decodes a V2G_Message, keeping only the selected fields of the body
+ * \param	stream		EXI stream, positioned at the EXI header
+ * \param	fields		Mask of the DIN_PROJ_* fields of the expected body element
+ * \param	projDoc		Compact decode target
+ * \return	Error-Code <> 0, EXI_ERROR_NOT_IN_PROJECTION if the body element is not projected
+ */
+int decode_dinProjectedExiDocument(bitstream_t* stream, uint16_t fields, struct dinProjectedDocument* projDoc);
+
+#endif /* DEPLOY_DIN_CODEC */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* EXI_din_PROJECTION_H */
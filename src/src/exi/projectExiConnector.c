@@ -9,22 +9,12 @@
 //#include "dinEXIDatatypesDecoder.h"
 
 
-const uint8_t mytestbuffer[EXI_TRANSMIT_BUFFER_SIZE] = {0x80, 0x9A, 0x01, 0x01, 0xBB, 0xC0, 0x1C, 0x51, 0xE0, 0x20, 0x1B, 0x71, 0x10, 0x9C, 0x7F, 0x64, 0x6C, 0x00, 0x00 };
-const uint8_t mytestbufferLen = 19;
-uint8_t exiTransmitBuffer[EXI_TRANSMIT_BUFFER_SIZE];
-struct dinEXIDocument dinDocEnc;
-struct dinEXIDocument dinDocDec;
-struct appHandEXIDocument aphsDoc;
-struct appHandEXIDocument appHandResp;
-bitstream_t global_streamEnc;
-bitstream_t global_streamDec;
-size_t global_streamEncPos;
-size_t global_streamDecPos;
-int g_errn;
+struct exiCodecContext exiContext;
 char gDebugString[100];
 char gResultString[500];
-uint8_t sessionId[SESSIONID_LEN];
-uint8_t sessionIdLen;
+
+/* compile time check of the RAM budget. A negative array size means a document does not fit into the arena anymore. */
+typedef char exiDocumentRamBudgetCheck[(EXI_DOCUMENT_RAM <= EXI_DOCUMENT_RAM_BUDGET) ? 1 : -1];
 
 
 #if defined(__cplusplus)
@@ -37,110 +27,366 @@ void addToTrace_chararray(char *s);
 #endif
 
 void debugAddStringAndInt(char *s, int i) {
-	char sTmp[1000];
-	sprintf(sTmp, "%s%d", s, i);
-	strcat(gDebugString, sTmp);
+	/* append in place, and never beyond the end of gDebugString. */
+	size_t len = strlen(gDebugString);
+	snprintf(gDebugString + len, sizeof(gDebugString) - len, "%s%d", s, i);
 }
 
-void projectExiConnector_decode_appHandExiDocument(void) {
-  /* precondition: The global_streamDec.size and global_streamDec.data have been set to the byte array with EXI data. */
+/* the generic string and binary decoders take their containers from the context */
+static void useDynamicMemory(struct exiCodecContext *ctx) {
+#if MEMORY_ALLOCATION == DYNAMIC_ALLOCATION
+	exiDynamicMemoryUse(&ctx->dynamicMemory);
+#else
+	(void)ctx;
+#endif
+}
 
-  global_streamDec.pos = &global_streamDecPos;
-  *(global_streamDec.pos) = 0; /* the decoder shall start at the byte 0 */	
-  g_errn = decode_appHandExiDocument(&global_streamDec, &aphsDoc);
+void exiCodec_init(struct exiCodecContext *ctx) {
+	memset(ctx, 0, sizeof(*ctx));
 }
 
-void projectExiConnector_decode_DinExiDocument(void) {
-  /* precondition: The global_streamDec.size and global_streamDec.data have been set to the byte array with EXI data. */
-
-  global_streamDec.pos = &global_streamDecPos;
-  *(global_streamDec.pos) = 0; /* the decoder shall start at the byte 0 */	
-  g_errn = decode_dinExiDocument(&global_streamDec, &dinDocDec);
-}
-
-#ifdef NOT_USED
-void projectExiConnector_testEncode(void) {
-	projectExiConnector_prepare_DinExiDocument();
-	dinDocEnc.V2G_Message.Body.SessionSetupReq_isUsed = 1u;
-	init_dinSessionSetupReqType(&dinDocEnc.V2G_Message.Body.SessionSetupReq);
-	/* In the session setup request, the session ID zero means: create a new session.
-	   The format (len 8, all zero) is taken from the original Ioniq behavior. */
-	dinDocEnc.V2G_Message.Header.SessionID.bytes[0] = 0;
-	dinDocEnc.V2G_Message.Header.SessionID.bytes[1] = 0;
-	dinDocEnc.V2G_Message.Header.SessionID.bytes[2] = 0;
-	dinDocEnc.V2G_Message.Header.SessionID.bytes[3] = 0;
-	dinDocEnc.V2G_Message.Header.SessionID.bytes[4] = 0;
-	dinDocEnc.V2G_Message.Header.SessionID.bytes[5] = 0;
-	dinDocEnc.V2G_Message.Header.SessionID.bytes[6] = 0;
-	dinDocEnc.V2G_Message.Header.SessionID.bytes[7] = 0;
-	dinDocEnc.V2G_Message.Header.SessionID.bytesLen = 8;
-	projectExiConnector_encode_DinExiDocument();
+void exiCodec_decode_appHandExiDocument(struct exiCodecContext *ctx) {
+  /* precondition: The ctx->streamDec.size and ctx->streamDec.data have been set to the byte array with EXI data. */
+
+  ctx->streamDec.pos = &ctx->streamDecPos;
+  *(ctx->streamDec.pos) = 0; /* the decoder shall start at the byte 0 */	
+  useDynamicMemory(ctx);
+  ctx->arenaState = EXI_ARENA_DECODED;
+  ctx->errn = decode_appHandExiDocument(&ctx->streamDec, &ctx->arena.appHand);
 }
+
+void exiCodec_decode_DinExiDocument(struct exiCodecContext *ctx) {
+  /* precondition: The ctx->streamDec.size and ctx->streamDec.data have been set to the byte array with EXI data. */
+
+  ctx->streamDec.pos = &ctx->streamDecPos;
+  *(ctx->streamDec.pos) = 0; /* the decoder shall start at the byte 0 */	
+  useDynamicMemory(ctx);
+  gDebugString[0] = 0; /* the debug trace belongs to this message only */
+  ctx->arenaState = EXI_ARENA_DECODED;
+  ctx->errn = decode_dinExiDocument(&ctx->streamDec, &ctx->arena.din);
+}
+
+void exiCodec_decode_DinProjectedExiDocument(struct exiCodecContext *ctx, uint16_t fields) {
+  /* precondition: The ctx->streamDec.size and ctx->streamDec.data have been set to the byte array with EXI data. */
+
+  ctx->streamDec.pos = &ctx->streamDecPos;
+  *(ctx->streamDec.pos) = 0; /* the decoder shall start at the byte 0 */
+  useDynamicMemory(ctx);
+  ctx->errn = decode_dinProjectedExiDocument(&ctx->streamDec, fields, &ctx->projDec);
+  if (ctx->errn == EXI_ERROR_NOT_IN_PROJECTION) {
+    /* Not a message we project, e.g. the EV skipped a step or stops the session. Decode it again from the start, in full. */
+    exiCodec_decode_DinExiDocument(ctx);
+  }
+}
+
+void exiCodec_resetArena(struct exiCodecContext *ctx) {
+	/* The documents init their own isUsed flags when they are decoded or prepared, so there is nothing to clear here.
+	   Only the bookkeeping says that the arena is free for the next exchange. */
+	ctx->arenaState = EXI_ARENA_EMPTY;
+#if MEMORY_ALLOCATION == DYNAMIC_ALLOCATION
+	exiDynamicMemoryReset(&ctx->dynamicMemory);
 #endif
+}
+
+void exiCodec_prepare_DinExiDocument(struct exiCodecContext *ctx) {
+	/* before filling and encoding the din document, we initialize here all its content. */
+	struct dinEXIDocument *doc = &ctx->arena.din;
+	ctx->arenaState = EXI_ARENA_ENCODING; /* from here on the decoded message is gone */
+	init_dinEXIDocument(doc);
+	doc->V2G_Message_isUsed = 1u;
+	init_dinMessageHeaderType(&doc->V2G_Message.Header);
+	init_dinBodyType(&doc->V2G_Message.Body);
+	/* take the sessionID from the context: */
+	memcpy(doc->V2G_Message.Header.SessionID.bytes, ctx->sessionID, SESSIONID_LEN);
+	doc->V2G_Message.Header.SessionID.bytesLen = ctx->sessionIDLen;
+}
+
+void exiCodec_encode_DinExiDocument(struct exiCodecContext *ctx) {
+  /* precondition: the din document is filled. Output: ctx->streamEnc.data and ctx->streamEncPos. */  
+	ctx->streamEnc.size = EXI_TRANSMIT_BUFFER_SIZE;
+	ctx->streamEnc.data = ctx->transmitBuffer;
+	ctx->streamEnc.pos = &ctx->streamEncPos;	
+	*(ctx->streamEnc.pos) = 0; /* start adding data at position 0 */
+	ctx->errn = encode_dinExiDocument(&ctx->streamEnc, &ctx->arena.din);
+
+}
+
+
+static void encodeAppHandResponse(struct exiCodecContext *ctx, uint8_t responseCode, const uint8_t *schemaId, uint8_t len) {
+	/* before filling and encoding the appHand document, we initialize here all its content. */
+	struct appHandEXIDocument *doc = &ctx->arena.appHand;
+	ctx->arenaState = EXI_ARENA_ENCODING;
+  	init_appHandEXIDocument(doc);
+	doc->supportedAppProtocolRes_isUsed = 1;
+	init_appHandAnonType_supportedAppProtocolRes(&doc->supportedAppProtocolRes);
+	doc->supportedAppProtocolRes.ResponseCode = (appHandresponseCodeType)responseCode;
+	if (len > 0) {
+		doc->supportedAppProtocolRes.SchemaID = *schemaId; /* signal the protocol by the provided schema id*/
+		doc->supportedAppProtocolRes.SchemaID_isUsed = 1;
+	}
+
+	ctx->streamEnc.size = EXI_TRANSMIT_BUFFER_SIZE;
+	ctx->streamEnc.data = ctx->transmitBuffer;
+	ctx->streamEnc.pos = &ctx->streamEncPos;	
+	*(ctx->streamEnc.pos) = 0; /* start adding data at position 0 */
+	ctx->errn = encode_appHandExiDocument(&ctx->streamEnc, doc);
+	
+}
+
+
+/* Response templates ***************************************************************************************
+   The responses up to the ContractAuthenticationRes are the same for every session, apart from the
+   SessionID (or the SchemaID for the supportedAppProtocolRes). We encode each of them once, remember
+   where the variable field sits in the bit stream, and later only copy the template and write the
+   actual value over that bit range.
+   The position is found by encoding the response twice, with the variable field all ones and all
+   zeros. The bits which differ are the field. This only works because the field has a fixed width
+   in the stream (SessionID bytes of a given length, 8 bit SchemaID). If the two encodings differ in
+   any other way, the template is not used and the response is encoded in full each time. */
+
+typedef void (*responseEncoder_t)(struct exiCodecContext *ctx, uint8_t responseId, const uint8_t *var, uint8_t varLen);
+
+static void fillDinResponse(struct dinBodyType *body, uint8_t responseId) {
+	switch (responseId) {
+	case DIN_RESPONSE_SESSIONSETUPRES:
+		body->SessionSetupRes_isUsed = 1;
+		init_dinSessionSetupResType(&body->SessionSetupRes);
+		body->SessionSetupRes.ResponseCode = dinresponseCodeType_OK_NewSessionEstablished;
+		body->SessionSetupRes.EVSEID.bytes[0] = 0;
+		body->SessionSetupRes.EVSEID.bytesLen = 1;
+		break;
+	case DIN_RESPONSE_SERVICEDISCOVERYRES:
+		body->ServiceDiscoveryRes_isUsed = 1;
+		init_dinServiceDiscoveryResType(&body->ServiceDiscoveryRes);
+		body->ServiceDiscoveryRes.ResponseCode = dinresponseCodeType_OK;
+		/* the mandatory fields in the ISO are PaymentOptionList and ChargeService.
+		But in the DIN, this is different, we find PaymentOptions, ChargeService and optional ServiceList */
+		body->ServiceDiscoveryRes.PaymentOptions.PaymentOption.array[0] = dinpaymentOptionType_ExternalPayment; /* EVSE handles the payment */
+		body->ServiceDiscoveryRes.PaymentOptions.PaymentOption.arrayLen = 1; /* just one single payment option in the table */
+		body->ServiceDiscoveryRes.ChargeService.ServiceTag.ServiceID = 1; /* todo: not clear what this means  */
+		body->ServiceDiscoveryRes.ChargeService.ServiceTag.ServiceCategory = dinserviceCategoryType_EVCharging;
+		body->ServiceDiscoveryRes.ChargeService.FreeService = 0; /* what ever this means. Just from example. */
+		/* dinEVSESupportedEnergyTransferType, e.g.
+		dinEVSESupportedEnergyTransferType_DC_combo_core or
+		dinEVSESupportedEnergyTransferType_DC_core or
+		dinEVSESupportedEnergyTransferType_DC_extended
+		dinEVSESupportedEnergyTransferType_AC_single_phase_core.
+		DC_extended means "extended pins of an IEC 62196-3 Configuration FF connector", which is
+		the normal CCS connector https://en.wikipedia.org/wiki/IEC_62196#FF) */
+		body->ServiceDiscoveryRes.ChargeService.EnergyTransferType = dinEVSESupportedEnergyTransferType_DC_extended;
+		break;
+	case DIN_RESPONSE_SERVICEPAYMENTSELECTIONRES:
+		body->ServicePaymentSelectionRes_isUsed = 1;
+		init_dinServicePaymentSelectionResType(&body->ServicePaymentSelectionRes);
+		body->ServicePaymentSelectionRes.ResponseCode = dinresponseCodeType_OK;
+		break;
+	case DIN_RESPONSE_CONTRACTAUTHENTICATIONRES:
+		body->ContractAuthenticationRes_isUsed = 1;
+		init_dinContractAuthenticationResType(&body->ContractAuthenticationRes);
+		body->ContractAuthenticationRes.ResponseCode = dinresponseCodeType_OK;
+		/* Set Authorisation immediately to 'Finished'. */
+		body->ContractAuthenticationRes.EVSEProcessing = dinEVSEProcessingType_Finished;
+		break;
+	}
+}
+
+static void encodeDinResponse(struct exiCodecContext *ctx, uint8_t responseId, const uint8_t *sessionID, uint8_t len) {
+	exiCodec_prepare_DinExiDocument(ctx);
+	memcpy(ctx->arena.din.V2G_Message.Header.SessionID.bytes, sessionID, len);
+	ctx->arena.din.V2G_Message.Header.SessionID.bytesLen = len;
+	fillDinResponse(&ctx->arena.din.V2G_Message.Body, responseId);
+	exiCodec_encode_DinExiDocument(ctx);
+}
+
+
+static void buildResponseTemplate(struct exiCodecContext *ctx, struct exiResponseTemplate *t, responseEncoder_t encodeResponse, uint8_t responseId, uint8_t varLen) {
+	uint8_t var[SESSIONID_LEN];
+	uint16_t i, first = 0, count = 0;
+	uint8_t diff;
+
+	t->len = 0;
+	t->varLen = varLen;
+	if (varLen == 0 || varLen > SESSIONID_LEN) return;
+
+	memset(var, 0xFF, varLen);
+	encodeResponse(ctx, responseId, var, varLen);
+	if (ctx->errn != 0 || ctx->streamEncPos > EXI_TEMPLATE_SIZE) return;
+	memcpy(t->bytes, ctx->transmitBuffer, ctx->streamEncPos);
+
+	memset(var, 0x00, varLen);
+	encodeResponse(ctx, responseId, var, varLen);
+	if (ctx->errn != 0) return;
+
+	for (i = 0; i < ctx->streamEncPos * 8; i++) {
+		diff = (t->bytes[i / 8] ^ ctx->transmitBuffer[i / 8]) & (0x80 >> (i % 8));
+		if (diff) {
+			if (count == 0) first = i;
+			else if (i != first + count) return; /* not one contiguous field */
+			count++;
+		}
+	}
+	if (count != varLen * 8) return;
+	t->varBitPos = first;
+	t->len = (uint8_t)ctx->streamEncPos;
+}
+
+/* writes len bytes at an arbitrary bit position, most significant bit first like the BitOutputStream */
+static void writeBytesAtBitPos(uint8_t *buffer, uint16_t bitPos, const uint8_t *src, uint8_t len) {
+	uint8_t shift = bitPos % 8;
+	uint8_t *p = buffer + bitPos / 8;
+	uint8_t i;
+	for (i = 0; i < len; i++) {
+		p[i] = (uint8_t)((p[i] & ~(0xFF >> shift)) | (src[i] >> shift));
+		if (shift) p[i + 1] = (uint8_t)((p[i + 1] & (0xFF >> shift)) | (src[i] << (8 - shift)));
+	}
+}
+
+static void copyTemplate(struct exiCodecContext *ctx, const struct exiResponseTemplate *t, const uint8_t *var, uint8_t varLen) {
+	memcpy(ctx->transmitBuffer, t->bytes, t->len);
+	writeBytesAtBitPos(ctx->transmitBuffer, t->varBitPos, var, varLen);
+	ctx->streamEnc.size = EXI_TRANSMIT_BUFFER_SIZE;
+	ctx->streamEnc.data = ctx->transmitBuffer;
+	ctx->streamEnc.pos = &ctx->streamEncPos;
+	ctx->streamEncPos = t->len;
+	ctx->errn = 0;
+}
+
+static void encodeFromTemplate(struct exiCodecContext *ctx, struct exiResponseTemplate *t, responseEncoder_t encodeResponse, uint8_t responseId, const uint8_t *var, uint8_t varLen) {
+	if (t->varLen != varLen) buildResponseTemplate(ctx, t, encodeResponse, responseId, varLen);
+	if (t->len == 0) {
+		encodeResponse(ctx, responseId, var, varLen); /* no template, the long way */
+		return;
+	}
+	copyTemplate(ctx, t, var, varLen);
+}
+
+void exiCodec_buildResponseTemplates(struct exiCodecContext *ctx) {
+	uint8_t i;
+	for (i = 0; i < DIN_RESPONSE_TEMPLATES; i++) {
+		buildResponseTemplate(ctx, &ctx->dinResponseTemplates[i], encodeDinResponse, i, SECC_SESSIONID_LEN);
+	}
+	buildResponseTemplate(ctx, &ctx->appHandResponseTemplate, encodeAppHandResponse, appHandresponseCodeType_OK_SuccessfulNegotiation, 1);
+}
+
+void exiCodec_encode_DinResponse(struct exiCodecContext *ctx, uint8_t responseId) {
+	if (responseId >= DIN_RESPONSE_TEMPLATES) {
+		ctx->errn = EXI_ERROR_UNEXPECTED_EVENT_LEVEL1;
+		return;
+	}
+	encodeFromTemplate(ctx, &ctx->dinResponseTemplates[responseId], encodeDinResponse, responseId, ctx->sessionID, ctx->sessionIDLen);
+}
+
+void exiCodec_encode_appHandExiDocument(struct exiCodecContext *ctx, uint8_t SchemaID) {
+	encodeFromTemplate(ctx, &ctx->appHandResponseTemplate, encodeAppHandResponse, appHandresponseCodeType_OK_SuccessfulNegotiation, &SchemaID, 1);
+}
+
+void exiCodec_encode_appHandResponse(struct exiCodecContext *ctx, uint8_t responseCode, uint8_t SchemaID) {
+	if (responseCode == appHandresponseCodeType_OK_SuccessfulNegotiation) {
+		exiCodec_encode_appHandExiDocument(ctx, SchemaID);
+	} else if (responseCode == appHandresponseCodeType_Failed_NoNegotiation) {
+		encodeAppHandResponse(ctx, responseCode, NULL, 0); /* no SchemaID, there is no protocol */
+	} else {
+		encodeAppHandResponse(ctx, responseCode, &SchemaID, 1); /* rare, no template for it */
+	}
+}
+
+/* Speculative responses ************************************************************************************
+   The CurrentDemandRes carries the present voltage and current, so it is no constant template. But between
+   two requests of the charge loop these values rarely change. So the application encodes the response
+   in the idle time after each change, the same way as a constant template, and when the request comes it
+   only patches in the SessionID. The template is only right for the values it was built with: the
+   application keeps track of them, and encodes in full when they changed since. */
+
+static void encodeDinSpeculativeResponse(struct exiCodecContext *ctx, uint8_t responseId, const uint8_t *sessionID, uint8_t len) {
+	(void)responseId;
+	exiCodec_prepare_DinExiDocument(ctx);
+	memcpy(ctx->arena.din.V2G_Message.Header.SessionID.bytes, sessionID, len);
+	ctx->arena.din.V2G_Message.Header.SessionID.bytesLen = len;
+	ctx->dinSpeculativeFill(&ctx->arena.din.V2G_Message.Body);
+	exiCodec_encode_DinExiDocument(ctx);
+}
+
+int exiCodec_buildSpeculativeDinResponse(struct exiCodecContext *ctx, uint8_t responseId, exiDinBodyFiller_t fill) {
+	struct exiResponseTemplate *t;
+
+	if (responseId >= DIN_SPECULATIVE_RESPONSES) return 0;
+	t = &ctx->dinSpeculativeTemplates[responseId];
+	t->len = 0;
+	/* the arena and the transmit buffer are free only between two exchanges */
+	if (ctx->arenaState != EXI_ARENA_EMPTY) return 0;
+	ctx->dinSpeculativeFill = fill;
+	buildResponseTemplate(ctx, t, encodeDinSpeculativeResponse, responseId, ctx->sessionIDLen);
+	ctx->dinSpeculativeFill = NULL;
+	exiCodec_resetArena(ctx);
+	return t->len != 0;
+}
+
+int exiCodec_encode_SpeculativeDinResponse(struct exiCodecContext *ctx, uint8_t responseId) {
+	const struct exiResponseTemplate *t;
+
+	if (responseId >= DIN_SPECULATIVE_RESPONSES) return 0;
+	t = &ctx->dinSpeculativeTemplates[responseId];
+	if (t->len == 0 || t->varLen != ctx->sessionIDLen) return 0;
+	copyTemplate(ctx, t, ctx->sessionID, ctx->sessionIDLen);
+	return 1;
+}
+
+void exiCodec_discardSpeculativeDinResponse(struct exiCodecContext *ctx, uint8_t responseId) {
+	if (responseId < DIN_SPECULATIVE_RESPONSES) ctx->dinSpeculativeTemplates[responseId].len = 0;
+}
+
+
+
+/* The projectExiConnector_* functions work on the context of this board, exiContext. */
+
+void projectExiConnector_decode_appHandExiDocument(void) {
+	exiCodec_decode_appHandExiDocument(&exiContext);
+}
+
+void projectExiConnector_decode_DinExiDocument(void) {
+	exiCodec_decode_DinExiDocument(&exiContext);
+}
+
+void projectExiConnector_decode_DinProjectedExiDocument(uint16_t fields) {
+	exiCodec_decode_DinProjectedExiDocument(&exiContext, fields);
+}
+
+void projectExiConnector_resetArena(void) {
+	exiCodec_resetArena(&exiContext);
+}
 
 void projectExiConnector_prepare_DinExiDocument(void) {
-	/* before filling and encoding the dinDocEnc, we initialize here all its content. */
-	init_dinEXIDocument(&dinDocEnc);
-	dinDocEnc.V2G_Message_isUsed = 1u;
-	init_dinMessageHeaderType(&dinDocEnc.V2G_Message.Header);
-	init_dinBodyType(&dinDocEnc.V2G_Message.Body);
-	/* take the sessionID from the global variable: */
-	memcpy(dinDocEnc.V2G_Message.Header.SessionID.bytes, sessionId, SESSIONID_LEN);
-	dinDocEnc.V2G_Message.Header.SessionID.bytesLen = sessionIdLen;
+	exiCodec_prepare_DinExiDocument(&exiContext);
 }
 
 void projectExiConnector_encode_DinExiDocument(void) {
-  /* precondition: dinDocEnc structure is filled. Output: global_stream.data and global_stream.pos. */  
-	global_streamEnc.size = EXI_TRANSMIT_BUFFER_SIZE;
-	global_streamEnc.data = exiTransmitBuffer;
-	global_streamEnc.pos = &global_streamEncPos;	
-	*(global_streamEnc.pos) = 0; /* start adding data at position 0 */
-	g_errn = encode_dinExiDocument(&global_streamEnc, &dinDocEnc);
-
+	exiCodec_encode_DinExiDocument(&exiContext);
 }
 
 void projectExiConnector_encode_appHandExiDocument(uint8_t SchemaID) {
-	/* before filling and encoding the appHandResp, we initialize here all its content. */
-	// still untested
-  	init_appHandEXIDocument(&appHandResp);
-	appHandResp.supportedAppProtocolRes_isUsed = 1;
-	appHandResp.supportedAppProtocolRes.ResponseCode = appHandresponseCodeType_OK_SuccessfulNegotiation;
-	appHandResp.supportedAppProtocolRes.SchemaID = SchemaID; /* signal the protocol by the provided schema id*/
-	appHandResp.supportedAppProtocolRes.SchemaID_isUsed = 1;
-
-	global_streamEnc.size = EXI_TRANSMIT_BUFFER_SIZE;
-	global_streamEnc.data = exiTransmitBuffer;
-	global_streamEnc.pos = &global_streamEncPos;	
-	*(global_streamEnc.pos) = 0; /* start adding data at position 0 */
-	g_errn = encode_appHandExiDocument(&global_streamEnc, &appHandResp);
-	
+	exiCodec_encode_appHandExiDocument(&exiContext, SchemaID);
 }
 
+void projectExiConnector_encode_appHandResponse(uint8_t responseCode, uint8_t SchemaID) {
+	exiCodec_encode_appHandResponse(&exiContext, responseCode, SchemaID);
+}
 
+void projectExiConnector_buildResponseTemplates(void) {
+	exiCodec_buildResponseTemplates(&exiContext);
+}
 
-#ifdef NOT_USED
-int projectExiConnector_test(int a) {
-  unsigned int i;
-  char s[100];
-  char s2[100];
-  strcpy(gDebugString, "");
-  global_streamDec.size = mytestbufferLen;
-  global_streamDec.data = mytestbuffer;
-  global_streamDec.pos = &global_streamDecPos;
-  *(global_streamDec.pos) = 0; /* the decoder shall start at the byte 0 */	
-  
-  for (i=0; i<1000; i++) { /* for runtime measuremement, run the decoder n times. */
-    g_errn = decode_dinExiDocument(&global_streamDec, &dinDocDec);
-  }
-  //dinDocDec.V2G_Message.Header.SessionID.bytesLen
-  addToTrace_chararray("Test from projectExiConnector_test");
-  sprintf(s, "SessionID ");
-  for (i=0; i<4; i++) {
-	sprintf(s2, "%hx ", dinDocDec.V2G_Message.Header.SessionID.bytes[i]);
-	strcat(s, s2);
-  }
-  addToTrace_chararray(s);  
-  //g_errn = encode_dinExiDocument(&global_streamEnc, &dinDocEnc);
- return 2*a;
+int projectExiConnector_buildSpeculativeDinResponse(uint8_t responseId, exiDinBodyFiller_t fill) {
+	return exiCodec_buildSpeculativeDinResponse(&exiContext, responseId, fill);
+}
+
+int projectExiConnector_encode_SpeculativeDinResponse(uint8_t responseId) {
+	return exiCodec_encode_SpeculativeDinResponse(&exiContext, responseId);
+}
+
+void projectExiConnector_discardSpeculativeDinResponse(uint8_t responseId) {
+	exiCodec_discardSpeculativeDinResponse(&exiContext, responseId);
+}
+
+void projectExiConnector_encode_DinResponse(uint8_t responseId) {
+	exiCodec_encode_DinResponse(&exiContext, responseId);
 }
-#endif
\ No newline at end of file
@@ -9,23 +9,111 @@
 #include "dinEXIDatatypes.h"
 #include "dinEXIDatatypesEncoder.h"
 #include "dinEXIDatatypesDecoder.h"
+#include "dinEXIProjection.h"
+#include "appHandNegotiation.h"
+#include "DynamicMemory.h"
 
 #define EXI_TRANSMIT_BUFFER_SIZE 256
-extern uint8_t exiTransmitBuffer[EXI_TRANSMIT_BUFFER_SIZE]; /* after encoding, here we find the exi byte stream. */
-
-extern struct appHandEXIDocument aphsDoc; /* The application handshake document. */
-extern struct dinEXIDocument dinDocEnc; /* The DIN document. For encoder. */
-extern struct dinEXIDocument dinDocDec; /* The DIN document. For decoder. */
-extern bitstream_t global_streamEnc; /* The byte stream descriptor. */
-extern bitstream_t global_streamDec; /* The byte stream descriptor. */
-extern size_t global_streamEncPos; /* The position in the stream. */
-extern size_t global_streamDecPos; /* The position in the stream. */
-extern char gResultString[500]; /* Debug info from the decoder. */
-extern int g_errn;
-
 #define SESSIONID_LEN 8
-extern uint8_t sessionId[SESSIONID_LEN];
-extern uint8_t sessionIdLen;
+#define SECC_SESSIONID_LEN 4 /* length of the SessionID we hand out in the SessionSetupRes */
+
+/* All EXI documents share one arena. Within one request/response exchange the received message is
+   decoded, evaluated, and only then the response is filled and encoded, and the application
+   handshake is over before the first DIN message arrives. So only one document is alive at a time:
+   dinDocDec and dinDocEnc are the same memory, as are aphsDoc and appHandResp, and the DIN and
+   the handshake documents overlap each other. A decoded message is valid until the response is
+   prepared, exiArenaState tells what the arena holds at the moment.
+   A new protocol adds its document to the union. */
+union exiDocumentArena {
+	struct dinEXIDocument din;
+	struct appHandEXIDocument appHand;
+};
+
+#define EXI_ARENA_EMPTY 0
+#define EXI_ARENA_DECODED 1 /* a received message, valid until the response is prepared */
+#define EXI_ARENA_ENCODING 2 /* the response which is filled and encoded */
+
+/* Static RAM taken by the EXI documents, and what four separate documents would take.
+   projectExiConnector.c refuses to compile if any document in the arena outgrows EXI_DOCUMENT_RAM_BUDGET,
+   the actual figures are reported on the serial console at boot. */
+#define EXI_DOCUMENT_RAM (sizeof(union exiDocumentArena))
+#define EXI_DOCUMENT_RAM_SEPARATE (2 * sizeof(struct dinEXIDocument) + 2 * sizeof(struct appHandEXIDocument))
+#define EXI_DOCUMENT_RAM_BUDGET 20000
+
+#define EXI_TEMPLATE_SIZE 64 /* longest response which is kept as template */
+
+#define DIN_RESPONSE_SESSIONSETUPRES 0
+#define DIN_RESPONSE_SERVICEDISCOVERYRES 1
+#define DIN_RESPONSE_SERVICEPAYMENTSELECTIONRES 2
+#define DIN_RESPONSE_CONTRACTAUTHENTICATIONRES 3
+#define DIN_RESPONSE_TEMPLATES 4
+
+/* Speculative responses, which depend on the EVSE values and are encoded before the request comes */
+#define DIN_SPECULATIVE_CURRENTDEMANDRES 0
+#define DIN_SPECULATIVE_RESPONSES 1
+
+
+/* Which decoder a received message goes to, see getDecodeKind() in tcp.cpp */
+#define EXI_DECODE_APPHAND 0
+#define EXI_DECODE_DIN 1
+#define EXI_DECODE_DIN_PROJECTED 2
+
+struct exiResponseTemplate {
+	uint8_t bytes[EXI_TEMPLATE_SIZE];
+	uint8_t len; /* 0 if the template could not be built */
+	uint8_t varLen; /* bytes of the variable field the template was built for */
+	uint16_t varBitPos; /* position of the first bit of the variable field */
+};
+
+/* fills the body of a speculative response, see exiCodec_buildSpeculativeDinResponse() */
+typedef void (*exiDinBodyFiller_t)(struct dinBodyType *body);
+
+/* Everything one EXI codec works on: streams, buffers, documents, session and error state.
+   Each charging port (or a sniffer, or a host test thread) owns one context, and the exiCodec_*
+   functions below only touch the context they are given. The scratch variables of the generated
+   codecs are EXI_THREAD_LOCAL, so contexts can also be used from different tasks at the same time. */
+struct exiCodecContext {
+	bitstream_t streamEnc; /* The byte stream descriptor. */
+	bitstream_t streamDec; /* The byte stream descriptor. */
+	size_t streamEncPos; /* The position in the stream. */
+	size_t streamDecPos; /* The position in the stream. */
+	int errn;
+	uint8_t transmitBuffer[EXI_TRANSMIT_BUFFER_SIZE]; /* after encoding, here we find the exi byte stream. */
+	uint8_t sessionID[SESSIONID_LEN];
+	uint8_t sessionIDLen;
+	uint8_t arenaState; /* EXI_ARENA_* */
+	union exiDocumentArena arena;
+	struct dinProjectedDocument projDec; /* The selected fields of a DIN message. For the projection decoder. */
+	struct exiResponseTemplate dinResponseTemplates[DIN_RESPONSE_TEMPLATES];
+	struct exiResponseTemplate appHandResponseTemplate;
+	struct exiResponseTemplate dinSpeculativeTemplates[DIN_SPECULATIVE_RESPONSES];
+	exiDinBodyFiller_t dinSpeculativeFill; /* only while a speculative template is built */
+#if MEMORY_ALLOCATION == DYNAMIC_ALLOCATION
+	struct exiDynamicMemory dynamicMemory; /* strings and binaries of the decoded message, freed by exiCodec_resetArena() */
+#endif
+};
+
+/* The context of the one charging port of this board. The projectExiConnector_* functions and the
+   names below work on it, so the application code reads as before. */
+extern struct exiCodecContext exiContext;
+
+#define exiTransmitBuffer (exiContext.transmitBuffer)
+#define exiArena (exiContext.arena)
+#define exiArenaState (exiContext.arenaState)
+#define aphsDoc (exiContext.arena.appHand) /* The application handshake document. For decoder. */
+#define appHandResp (exiContext.arena.appHand) /* The application handshake document. For encoder. */
+#define dinDocEnc (exiContext.arena.din) /* The DIN document. For encoder. */
+#define dinDocDec (exiContext.arena.din) /* The DIN document. For decoder. */
+#define dinProjDec (exiContext.projDec)
+#define global_streamEnc (exiContext.streamEnc)
+#define global_streamDec (exiContext.streamDec)
+#define global_streamEncPos (exiContext.streamEncPos)
+#define global_streamDecPos (exiContext.streamDecPos)
+#define g_errn (exiContext.errn)
+#define sessionId (exiContext.sessionID)
+#define sessionIdLen (exiContext.sessionIDLen)
+
+extern char gResultString[500]; /* Debug info from the decoder. */
 
 
 
@@ -51,6 +139,29 @@ void projectExiConnector_decode_DinExiDocument(void);
 }
 #endif
 
+#if defined(__cplusplus)
+extern "C"
+{
+#endif
+void projectExiConnector_decode_DinProjectedExiDocument(uint16_t fields);
+  /* precondition: as above. Decodes only the DIN_PROJ_* fields into dinProjDec. If the body element
+     is not one of the projected ones, dinProjDec.bodyElement is DIN_PROJ_BODY_NONE and the message
+     is decoded in full into dinDocDec instead. */
+#if defined(__cplusplus)
+}
+#endif
+
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif
+void projectExiConnector_resetArena(void);
+  /* end of a request/response exchange, nothing in the arena is needed anymore. */
+#if defined(__cplusplus)
+}
+#endif
+
 
 /* Encoder functions ****************************************************************************************/
 #if defined(__cplusplus)
@@ -80,28 +191,74 @@ extern "C"
 {
 #endif
 void projectExiConnector_encode_appHandExiDocument(uint8_t SchemaID);
-  
+  /* encodes the supportedAppProtocolRes from its template. Output: global_stream.data and global_stream.pos. */
 #if defined(__cplusplus)
 }
 #endif
 
+#if defined(__cplusplus)
+extern "C"
+{
+#endif
+void projectExiConnector_encode_appHandResponse(uint8_t responseCode, uint8_t SchemaID);
+  /* encodes the supportedAppProtocolRes for any appHandresponseCodeType, e.g. the result of appHand_negotiate().
+     With Failed_NoNegotiation the SchemaID is left out. */
+#if defined(__cplusplus)
+}
+#endif
+
+
+/* Response templates ***************************************************************************************/
+#if defined(__cplusplus)
+extern "C"
+{
+#endif
+void projectExiConnector_buildResponseTemplates(void);
+  /* encodes the constant responses once, for a SessionID of SECC_SESSIONID_LEN. Call at startup. */
+#if defined(__cplusplus)
+}
+#endif
 
-/* Test functions, just for experimentation *****************************************************************/
 #if defined(__cplusplus)
 extern "C"
 {
 #endif
-void projectExiConnector_testEncode(void);
+void projectExiConnector_encode_DinResponse(uint8_t responseId);
+  /* copies the DIN_RESPONSE_* template and patches in the sessionId. Output: global_stream.data and global_stream.pos.
+     A template for another sessionIdLen is rebuilt on first use. */
+int projectExiConnector_buildSpeculativeDinResponse(uint8_t responseId, exiDinBodyFiller_t fill);
+  /* encodes the DIN_SPECULATIVE_* response which fill() describes into its template, for the sessionId of the
+     running session. Only between two requests, it returns 0 without a template while a message is in the arena. */
+int projectExiConnector_encode_SpeculativeDinResponse(uint8_t responseId);
+  /* like projectExiConnector_encode_DinResponse(), from the speculative template. Returns 0 if there is none,
+     then the caller encodes the response in full. */
+void projectExiConnector_discardSpeculativeDinResponse(uint8_t responseId);
 #if defined(__cplusplus)
 }
 #endif
 
 
+/* Codec context functions **********************************************************************************
+   The same operations as above, on a context of its own. Before the first use the context is zeroed,
+   or initialized with exiCodec_init(). */
 #if defined(__cplusplus)
 extern "C"
 {
 #endif
-int projectExiConnector_test(int a);
+void exiCodec_init(struct exiCodecContext *ctx);
+void exiCodec_decode_appHandExiDocument(struct exiCodecContext *ctx);
+void exiCodec_decode_DinExiDocument(struct exiCodecContext *ctx);
+void exiCodec_decode_DinProjectedExiDocument(struct exiCodecContext *ctx, uint16_t fields);
+void exiCodec_resetArena(struct exiCodecContext *ctx);
+void exiCodec_prepare_DinExiDocument(struct exiCodecContext *ctx);
+void exiCodec_encode_DinExiDocument(struct exiCodecContext *ctx);
+void exiCodec_encode_appHandExiDocument(struct exiCodecContext *ctx, uint8_t SchemaID);
+void exiCodec_encode_appHandResponse(struct exiCodecContext *ctx, uint8_t responseCode, uint8_t SchemaID);
+void exiCodec_buildResponseTemplates(struct exiCodecContext *ctx);
+void exiCodec_encode_DinResponse(struct exiCodecContext *ctx, uint8_t responseId);
+int exiCodec_buildSpeculativeDinResponse(struct exiCodecContext *ctx, uint8_t responseId, exiDinBodyFiller_t fill);
+int exiCodec_encode_SpeculativeDinResponse(struct exiCodecContext *ctx, uint8_t responseId);
+void exiCodec_discardSpeculativeDinResponse(struct exiCodecContext *ctx, uint8_t responseId);
 #if defined(__cplusplus)
 }
 #endif
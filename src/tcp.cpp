@@ -2,6 +2,8 @@
 #include "main.h"
 #include "ipv6.h"
 #include "tcp.h"
+#include "soc.h"
+#include "recovery.h"
 #include "src/exi/projectExiConnector.h"
 #include <WebSerial.h>
 
@@ -9,7 +11,9 @@
 
 #define NEXT_TCP 0x06  // the next protocol is TCP
 
+#define TCP_FLAG_FIN 0x01
 #define TCP_FLAG_SYN 0x02
+#define TCP_FLAG_RST 0x04
 #define TCP_FLAG_PSH 0x08
 #define TCP_FLAG_ACK 0x10
 
@@ -40,7 +44,7 @@ uint32_t TcpSeqNr;
 uint32_t TcpAckNr;
 
 #define TCP_RX_DATA_LEN 1000
-uint8_t tcp_rxdataLen=0;
+uint16_t tcp_rxdataLen=0;
 uint8_t tcp_rxdata[TCP_RX_DATA_LEN];
 
 #define stateWaitForSupportedApplicationProtocolRequest 0
@@ -52,17 +56,97 @@ uint8_t tcp_rxdata[TCP_RX_DATA_LEN];
 #define stateWaitForCableCheckRequest 6
 #define stateWaitForPreChargeRequest 7
 #define stateWaitForPowerDeliveryRequest 8
+#define stateWaitForCurrentDemandRequest 9
+#define stateWaitForWeldingDetectionRequest 10
+#define stateWaitForSessionStopRequest 11 /* we asked the EV to stop, see socOnlySession */
+#define V2G_STATES 12
+
+const char *v2gStateNames[V2G_STATES] = {
+    "SupportedApplicationProtocol", "SessionSetup", "ServiceDiscovery", "ServicePaymentSelection", "ContractAuthentication",
+    "ChargeParameterDiscovery", "CableCheck", "PreCharge", "PowerDelivery", "CurrentDemand", "WeldingDetection", "SessionStop"
+};
+
+/* The requests, the same for all protocols. */
+#define V2G_MSG_NONE 0 /* nothing we could decode */
+#define V2G_MSG_SUPPORTEDAPPPROTOCOL 1
+#define V2G_MSG_SESSIONSETUP 2
+#define V2G_MSG_SERVICEDISCOVERY 3
+#define V2G_MSG_SERVICEDETAIL 4
+#define V2G_MSG_PAYMENTSELECTION 5
+#define V2G_MSG_AUTHORIZATION 6
+#define V2G_MSG_CHARGEPARAMETERDISCOVERY 7
+#define V2G_MSG_CABLECHECK 8
+#define V2G_MSG_PRECHARGE 9
+#define V2G_MSG_POWERDELIVERY_START 10
+#define V2G_MSG_POWERDELIVERY_STOP 11
+#define V2G_MSG_CURRENTDEMAND 12
+#define V2G_MSG_CHARGINGSTATUS 13
+#define V2G_MSG_METERINGRECEIPT 14
+#define V2G_MSG_WELDINGDETECTION 15
+#define V2G_MSG_SESSIONSTOP 16
+#define V2G_MSGS 17
+
+const char *v2gMessageNames[V2G_MSGS] = {
+    "none", "SupportedAppProtocol", "SessionSetup", "ServiceDiscovery", "ServiceDetail", "PaymentSelection", "Authorization",
+    "ChargeParameterDiscovery", "CableCheck", "PreCharge", "PowerDelivery(start)", "PowerDelivery(stop)", "CurrentDemand",
+    "ChargingStatus", "MeteringReceipt", "WeldingDetection", "SessionStop"
+};
+
+#define V2G_ANY_PROTOCOL 0xFE /* v2gTransition.protocol of the handshake, which comes before the protocol is known */
+
+/* results of a request handler */
+#define V2G_NEXT_STATE 0
+#define V2G_END_SESSION 1 /* the response was the last one of the session */
+#define V2G_STOP_SESSION 2 /* the response asked the EV to stop, it ends the session with its own requests */
+
+/* DIN 70121 */
+#define V2G_SECC_SEQUENCE_TIMEOUT_MS 60000         /* from one response to the next request */
+#define V2G_SECC_COMMUNICATIONSETUP_TIMEOUT_MS 20000 /* from the handshake to the SessionSetupReq */
+/* ours: from asking the EV to stop until we close the connection, long before its CableCheck timeout */
+#define V2G_STOP_TIMEOUT_MS 5000
+
+/* fields of the ChargeParameterDiscoveryReq which are read in stateWaitForChargeParameterDiscoveryRequest */
+#define CPD_PROJECTED_FIELDS (DIN_PROJ_CPD_EVRESSSOC | DIN_PROJ_CPD_FULLSOC | DIN_PROJ_CPD_EVENERGYREQUEST | DIN_PROJ_CPD_EVENERGYCAPACITY)
+
+/* Without a power stage, all we want from the EV is its SoC. Then the session ends after the
+   ChargeParameterDiscovery: the response tells the EV to stop, and the EV leaves with a PowerDelivery(stop)
+   and SessionStop, without an error. The EVSE can then offer AC. */
+uint8_t socOnlySession = SOC_ONLY_SESSION;
+uint8_t v2gStopCharging = 0; /* the DC_EVSEStatus tells the EV to stop */
+struct socTiming plugInToSoc;
 
 uint8_t fsmState = stateWaitForSupportedApplicationProtocolRequest;
-
-void routeDecoderInputData(void) {
+unsigned long v2gStateTimer = 0;    // millis() when fsmState was entered
+unsigned long v2gSequenceTimer = 0; // millis() of the last response
+uint32_t v2gSequenceTimeout = 0;    // for the next request, 0 while no session runs
+
+/* What the power stage delivers. This board has none of its own, see powerStage_setTarget(). */
+float EVSEPresentVoltage = 0; /* V */
+float EVSEPresentCurrent = 0; /* A */
+
+/* The CurrentDemandReq/Res cycle runs every ~100ms for the whole charge. Its time from the received
+   request to the transmitted response is kept here, and the Timer20ms task polls the modem faster while it runs. */
+uint8_t v2gHotPath = 0;
+uint32_t v2gRequestMicros; /* when the last segment of the request arrived */
+struct v2gLatency currentDemandLatency;
+
+/* The CurrentDemandRes is encoded ahead of the request, see updateSpeculativeResponses(). The template
+   holds these present values, and is only sent while the EVSE values still encode the same. */
+uint8_t currentDemandSpeculated = 0;
+struct dinPhysicalValueType speculatedVoltage, speculatedCurrent;
+
+uint8_t v2gProtocol = APPHAND_PROTOCOL_DIN; /* agreed in the supportedAppProtocol handshake */
+struct appHandNegotiation appHandResult; /* the last handshake */
+uint16_t appHandNegotiations[APPHAND_PROTOCOLS + 1]; /* handshakes per negotiated protocol, the last one counts the failed ones */
+
+void routeDecoderInputData(uint32_t exiLen) {
     /* connect the data from the TCP to the exiDecoder */
     /* The TCP receive data consists of two parts: 1. The V2GTP header and 2. the EXI stream.
         The decoder wants only the EXI stream, so we skip the V2GTP header.
         In best case, we would check also the consistency of the V2GTP header here.
     */
     global_streamDec.data = &tcp_rxdata[V2GTP_HEADER_SIZE];
-    global_streamDec.size = tcp_rxdataLen - V2GTP_HEADER_SIZE;
+    global_streamDec.size = exiLen; /* the next message may follow in tcp_rxdata */
     
     /* We have something to decode, this is a good sign that the connection is fine.
         Inform the ConnectionManager that everything is fine. */
@@ -113,262 +197,751 @@ void addV2GTPHeaderAndTransmit(const uint8_t *exiBuffer, uint8_t exiBufferLen) {
 }
 
 
-void decodeV2GTP(void) {
+uint8_t getDecodeKind(void) {
+    if (fsmState == stateWaitForChargeParameterDiscoveryRequest) {
+        return EXI_DECODE_DIN_PROJECTED; // we only need the SoC and energy values, decode just those
+    }
+    if (fsmState) return EXI_DECODE_DIN; // Decode DIN EXI
+    return EXI_DECODE_APPHAND;           // Decode Handshake EXI (on first state only)
+}
 
-    uint16_t arrayLen, i;
-    uint8_t strNamespace[50];
-    uint8_t SchemaID, n;
-    uint16_t NamespaceLen;
 
+/* Reports what the car told us in the ChargeParameterDiscoveryReq. */
+void reportChargeParameters(uint8_t full_soc, float energy_request, float energy_capacity) {
 
-    routeDecoderInputData();
-    if (fsmState) projectExiConnector_decode_DinExiDocument();      // Decode DIN EXI
-    else projectExiConnector_decode_appHandExiDocument();           // Decode Handshake EXI (on first state only)
-    tcp_rxdataLen = 0; /* mark the input data as "consumed" */
+    WebSerial.printf("Current SoC %d%%\n", EVSOC);
+    WebSerial.printf("Target SoC %d%%\n", full_soc);
+    WebSerial.printf("Energy Request: %.0f Wh\n", energy_request);
+    WebSerial.printf("Energy Capacity: %.0f Wh\n", energy_capacity);
 
-    if (fsmState == stateWaitForSupportedApplicationProtocolRequest) {
+    String evccid_string = macArrayToString(EVCCID);
 
-        // Check if we have received the correct message
-        if (aphsDoc.supportedAppProtocolReq_isUsed) {
-        
-            WebSerial.printf("SupportedApplicationProtocolRequest\n");
-            // process data when no errors occured during decoding
-            if (g_errn == 0) {
-                arrayLen = aphsDoc.supportedAppProtocolReq.AppProtocol.arrayLen;
-                WebSerial.printf("The car supports %u schemas.\n", arrayLen);
-            
-                // check all schemas for DIN
-                for(n=0; n<arrayLen; n++) {
-                    memset(strNamespace, 0, sizeof(strNamespace));
-                    NamespaceLen = aphsDoc.supportedAppProtocolReq.AppProtocol.array[n].ProtocolNamespace.charactersLen;
-                    SchemaID = aphsDoc.supportedAppProtocolReq.AppProtocol.array[n].SchemaID;
-                    for (i=0; i< NamespaceLen; i++) {
-                        strNamespace[i] = aphsDoc.supportedAppProtocolReq.AppProtocol.array[n].ProtocolNamespace.characters[i];    
-                    }
-                    WebSerial.printf("strNameSpace %s SchemaID: %u\n", strNamespace, SchemaID);
-
-                    if (strstr((const char*)strNamespace, ":din:70121:") != NULL) {
-                        WebSerial.printf("Detected DIN\n");
-                        projectExiConnector_encode_appHandExiDocument(SchemaID); // test
-                        // Send supportedAppProtocolRes to EV
-                        addV2GTPHeaderAndTransmit(global_streamEnc.data, global_streamEncPos);
-                        fsmState = stateWaitForSessionSetupRequest;
-                    }
-                }
-            }
+    socEstimate_correct(EVSOC, full_soc, energy_capacity, energy_request); // the estimate starts over from here
+    sendSocCallback(
+        (float)EVSOC,           // Current SoC (uint8_t -> float)
+        (float)full_soc,        // Target SoC (uint8_t -> float)
+        energy_capacity,        // Energy Capacity (float)
+        energy_request,         // Energy Request (float)
+        evccid_string,          // EVCCID String
+        100                     // read from the EV, no estimate
+    );
+}
+
+
+/* The power stage gets the EV's target. Without a power stage, the voltage simply follows the target,
+   as the DC link would after a precharge, and no current flows. A power module driver replaces this
+   function, and updates EVSEPresentVoltage and EVSEPresentCurrent from its measurements. */
+void __attribute__((weak)) powerStage_setTarget(float voltage, float current) {
+    (void)current;
+    EVSEPresentVoltage = voltage;
+    EVSEPresentCurrent = 0;
+}
+
+float dinPhysicalValue(const struct dinPhysicalValueType *pv) {
+    return (float)pv->Value * pow(10, pv->Multiplier);
+}
+
+void setDinPhysicalValue(struct dinPhysicalValueType *pv, float value, dinunitSymbolType unit) {
+    int8_t multiplier = 0;
+
+    // the value is a 16 bit integer, bigger ones are scaled down by the multiplier
+    while (value > INT16_MAX || value < INT16_MIN) {
+        value /= 10;
+        multiplier++;
+    }
+    pv->Value = (int16_t)value;
+    pv->Multiplier = multiplier;
+    pv->Unit = unit;
+    pv->Unit_isUsed = 1;
+}
+
+void setDinEVSEStatus(struct dinDC_EVSEStatusType *status, uint8_t isolationChecked) {
+    if (isolationChecked) {
+        status->EVSEIsolationStatus = dinisolationLevelType_Valid;
+        status->EVSEIsolationStatus_isUsed = 1;
+    }
+    status->NotificationMaxDelay = 0;
+    if (v2gStopCharging) {
+        status->EVSEStatusCode = dinDC_EVSEStatusCodeType_EVSE_Shutdown;
+        status->EVSENotification = dinEVSENotificationType_StopCharging;
+    } else {
+        status->EVSEStatusCode = dinDC_EVSEStatusCodeType_EVSE_Ready;
+        status->EVSENotification = dinEVSENotificationType_None;
+    }
+}
+
+/* time from the received request to the transmitted response */
+void recordLatency(struct v2gLatency *latency) {
+    uint32_t us = micros() - v2gRequestMicros;
+
+    latency->lastUs = us;
+    latency->sumUs += us;
+    latency->count++;
+    if (us > latency->maxUs) latency->maxUs = us;
+    if (us > V2G_LATENCY_BUDGET_US) latency->overBudget++;
+}
+
+void reportLatency(const char *name, const struct v2gLatency *latency) {
+    if (latency->count == 0) return;
+    WebSerial.printf("%s: %lu cycles, response after %lu us on average, %lu us max, %lu over the %u us budget, %lu pre-encoded\n", name,
+        (unsigned long)latency->count, (unsigned long)(latency->sumUs / latency->count), (unsigned long)latency->maxUs,
+        (unsigned long)latency->overBudget, V2G_LATENCY_BUDGET_US, (unsigned long)latency->preEncoded);
+}
+
+/* adds the time from the plug-in to a milestone, returns it */
+uint32_t recordTiming(struct socTiming *timing) {
+    uint32_t ms = millis() - plugInTimer;
+
+    timing->lastMs = ms;
+    timing->sumMs += ms;
+    timing->count++;
+    if (timing->count == 1 || ms < timing->minMs) timing->minMs = ms;
+    if (ms > timing->maxMs) timing->maxMs = ms;
+    return ms;
+}
+
+/* time from the plug-in to the SoC, the number that matters when we only read the SoC */
+void recordSocTime(void) {
+    uint32_t ms = recordTiming(&plugInToSoc);
+
+    WebSerial.printf("[V2G] SoC %u%% after %lu ms from plug-in. %lu sessions: %lu ms best, %lu ms average, %lu ms worst\n",
+        EVSOC, (unsigned long)ms, (unsigned long)plugInToSoc.count, (unsigned long)plugInToSoc.minMs,
+        (unsigned long)(plugInToSoc.sumMs / plugInToSoc.count), (unsigned long)plugInToSoc.maxMs);
+}
+
+/* Session bookkeeping *******************************************************************************************/
+
+void enterV2GState(uint8_t state, uint32_t timeoutMs) {
+    unsigned long now = millis();
+
+    if (state != fsmState) {
+        WebSerial.printf("[V2G] %s -> %s after %lu ms\n", v2gStateNames[fsmState], v2gStateNames[state], now - v2gStateTimer);
+        v2gStateTimer = now;
+        fsmState = state;
+    }
+    v2gSequenceTimer = now; // the next request is due within timeoutMs
+    v2gSequenceTimeout = timeoutMs;
+}
+
+/* Back to the start, the EV begins its next session with a new TCP connection and handshake. */
+void resetV2GSession(const char *reason) {
+    WebSerial.printf("[V2G] session ends in %s: %s\n", v2gStateNames[fsmState], reason);
+    if (v2gHotPath) {
+        v2gHotPath = 0;
+        reportLatency("CurrentDemand", &currentDemandLatency);
+    }
+    powerStage_setTarget(0, 0);
+    v2gStopCharging = 0;
+    tcp_rxdataLen = 0;
+    enterV2GState(stateWaitForSupportedApplicationProtocolRequest, 0);
+    tcpState = TCP_STATE_CLOSED; // accept the next SYN
+}
+
+/* The regular end, with a SessionStop, or a response which tells the EV we cannot charge it. Failures go
+   through recoverFrom(), which keeps the EV in our AVLN. */
+void endV2GSession(const char *reason) {
+    resetV2GSession(reason);
+    recoverySucceeded();
+    sessionEnded(reason); // the EV leaves our AVLN, unless we want its SoC again
+}
+
+uint8_t v2gSessionRunning(void) {
+    return fsmState != stateWaitForSupportedApplicationProtocolRequest || tcpState != TCP_STATE_CLOSED;
+}
+
+/* Called by the Timer20ms task. A stalled EV must not hold the charger forever. */
+void checkV2GTimeouts(void) {
+    if (v2gSequenceTimeout == 0) return;
+    // The requests of an EV which ignores our StopCharging do not extend this, v2gStateTimer is set once
+    if (fsmState == stateWaitForSessionStopRequest && millis() - v2gStateTimer > V2G_STOP_TIMEOUT_MS) {
+        if (tcpState == TCP_STATE_ESTABLISHED) tcp_sendFinAck();
+        endV2GSession("the EV did not stop");
+        return;
+    }
+    if (millis() - v2gSequenceTimer > v2gSequenceTimeout) recoverFrom(RECOVER_V2G, "V2G_SECC_Sequence_Timeout");
+}
+
+
+/* Handshake *****************************************************************************************************/
+
+uint8_t handleSupportedAppProtocolRequest(void) {
+    uint16_t arrayLen;
+    const char *strNamespace;
+    uint8_t n;
+
+    WebSerial.printf("SupportedApplicationProtocolRequest\n");
+    arrayLen = aphsDoc.supportedAppProtocolReq.AppProtocol.arrayLen;
+    WebSerial.printf("The car supports %u schemas.\n", arrayLen);
+    for(n=0; n<arrayLen; n++) {
+        // With the ASCII string representation the decoder stores the namespace
+        // null terminated, so we can print it in place.
+        strNamespace = aphsDoc.supportedAppProtocolReq.AppProtocol.array[n].ProtocolNamespace.characters;
+        WebSerial.printf("strNameSpace %s SchemaID: %u Priority: %u\n", strNamespace,
+            aphsDoc.supportedAppProtocolReq.AppProtocol.array[n].SchemaID,
+            aphsDoc.supportedAppProtocolReq.AppProtocol.array[n].Priority);
+        if (strstr(strNamespace, ":15118:-20:") != NULL) {
+            // ISO 15118-20 needs TLS and its own codecs, neither of which we have.
+            WebSerial.printf("ISO 15118-20 offered, not supported\n");
         }
+    }
 
-    } else if (fsmState == stateWaitForSessionSetupRequest) {
-        
-        // Check if we have received the correct message
-        if (dinDocDec.V2G_Message.Body.SessionSetupReq_isUsed) {
-
-            WebSerial.printf("SessionSetupReqest\n");
-
-            //n = dinDocDec.V2G_Message.Header.SessionID.bytesLen;
-            //for (i=0; i< n; i++) {
-            //    WebSerial.printf("%02x", dinDocDec.V2G_Message.Header.SessionID.bytes[i] );
-            //}
-            n = dinDocDec.V2G_Message.Body.SessionSetupReq.EVCCID.bytesLen;
-            if (n>6) n=6;       // out of range check
-            WebSerial.printf("EVCCID=");
-            for (i=0; i<n; i++) {
-                EVCCID[i]= dinDocDec.V2G_Message.Body.SessionSetupReq.EVCCID.bytes[i];
-                WebSerial.printf("%02x", EVCCID[i] );
-            }
-            WebSerial.printf("\n");
-            
-            sessionId[0] = 1;   // our SessionId is set up here, and used by _prepare_DinExiDocument
-            sessionId[1] = 2;   // This SessionID will be used by the EV in future communication
-            sessionId[2] = 3;
-            sessionId[3] = 4;
-            sessionIdLen = 4;
-
-            // Now prepare the 'SessionSetupResponse' message to send back to the EV
-            projectExiConnector_prepare_DinExiDocument();
-            
-            dinDocEnc.V2G_Message.Body.SessionSetupRes_isUsed = 1;
-            init_dinSessionSetupResType(&dinDocEnc.V2G_Message.Body.SessionSetupRes);
-            dinDocEnc.V2G_Message.Body.SessionSetupRes.ResponseCode = dinresponseCodeType_OK_NewSessionEstablished;
-            
-            dinDocEnc.V2G_Message.Body.SessionSetupRes.EVSEID.bytes[0] = 0;
-            dinDocEnc.V2G_Message.Body.SessionSetupRes.EVSEID.bytesLen = 1;
-
-            // Send SessionSetupResponse to EV
-            global_streamEncPos = 0;
-            projectExiConnector_encode_DinExiDocument();
-            addV2GTPHeaderAndTransmit(global_streamEnc.data, global_streamEncPos);
-            fsmState = stateWaitForServiceDiscoveryRequest;
-        }    
-        
-    } else if (fsmState == stateWaitForServiceDiscoveryRequest) {
+    // choose one of the schemas we support, by the car's priority and our preference
+    appHand_negotiate(&aphsDoc.supportedAppProtocolReq, &appHandResult);
+    appHandNegotiations[appHandResult.protocol == APPHAND_PROTOCOL_NONE ? APPHAND_PROTOCOLS : appHandResult.protocol]++;
+    WebSerial.printf("Negotiated %s, SchemaID %u, %u of %u schemas supported\n",
+        appHand_protocolName(appHandResult.protocol), appHandResult.SchemaID, appHandResult.matched, appHandResult.offered);
+
+    // Send exactly one supportedAppProtocolRes to EV, also if nothing matched. Encoding it reuses the memory of aphsDoc.
+    projectExiConnector_encode_appHandResponse(appHandResult.responseCode, appHandResult.SchemaID);
+    addV2GTPHeaderAndTransmit(global_streamEnc.data, global_streamEncPos);
+    if (appHandResult.protocol == APPHAND_PROTOCOL_NONE) return V2G_END_SESSION;
+    v2gProtocol = appHandResult.protocol;
+    return V2G_NEXT_STATE;
+}
 
 
-                
-        // Check if we have received the correct message
-        if (dinDocDec.V2G_Message.Body.ServiceDiscoveryReq_isUsed) {
-
-            WebSerial.printf("ServiceDiscoveryReqest\n");
-            n = dinDocDec.V2G_Message.Header.SessionID.bytesLen;
-            WebSerial.printf("SessionID:");
-            for (i=0; i<n; i++) WebSerial.printf("%02x", dinDocDec.V2G_Message.Header.SessionID.bytes[i] );
-            WebSerial.printf("\n");
-            
-            // Now prepare the 'ServiceDiscoveryResponse' message to send back to the EV
-            projectExiConnector_prepare_DinExiDocument();
-            
-            dinDocEnc.V2G_Message.Body.ServiceDiscoveryRes_isUsed = 1;
-            init_dinServiceDiscoveryResType(&dinDocEnc.V2G_Message.Body.ServiceDiscoveryRes);
-            dinDocEnc.V2G_Message.Body.ServiceDiscoveryRes.ResponseCode = dinresponseCodeType_OK;
-            /* the mandatory fields in the ISO are PaymentOptionList and ChargeService.
-            But in the DIN, this is different, we find PaymentOptions, ChargeService and optional ServiceList */
-            dinDocEnc.V2G_Message.Body.ServiceDiscoveryRes.PaymentOptions.PaymentOption.array[0] = dinpaymentOptionType_ExternalPayment; /* EVSE handles the payment */
-            dinDocEnc.V2G_Message.Body.ServiceDiscoveryRes.PaymentOptions.PaymentOption.arrayLen = 1; /* just one single payment option in the table */
-            dinDocEnc.V2G_Message.Body.ServiceDiscoveryRes.ChargeService.ServiceTag.ServiceID = 1; /* todo: not clear what this means  */
-            //dinDocEnc.V2G_Message.Body.ServiceDiscoveryRes.ChargeService.ServiceTag.ServiceName
-            //dinDocEnc.V2G_Message.Body.ServiceDiscoveryRes.ChargeService.ServiceTag.ServiceName_isUsed
-            dinDocEnc.V2G_Message.Body.ServiceDiscoveryRes.ChargeService.ServiceTag.ServiceCategory = dinserviceCategoryType_EVCharging;
-            //dinDocEnc.V2G_Message.Body.ServiceDiscoveryRes.ChargeService.ServiceTag.ServiceScope
-            //dinDocEnc.V2G_Message.Body.ServiceDiscoveryRes.ChargeService.ServiceTag.ServiceScope_isUsed
-            dinDocEnc.V2G_Message.Body.ServiceDiscoveryRes.ChargeService.FreeService = 0; /* what ever this means. Just from example. */
-            /* dinEVSESupportedEnergyTransferType, e.g.
-            dinEVSESupportedEnergyTransferType_DC_combo_core or
-            dinEVSESupportedEnergyTransferType_DC_core or
-            dinEVSESupportedEnergyTransferType_DC_extended
-            dinEVSESupportedEnergyTransferType_AC_single_phase_core.
-            DC_extended means "extended pins of an IEC 62196-3 Configuration FF connector", which is
-            the normal CCS connector https://en.wikipedia.org/wiki/IEC_62196#FF) */
-            dinDocEnc.V2G_Message.Body.ServiceDiscoveryRes.ChargeService.EnergyTransferType = dinEVSESupportedEnergyTransferType_DC_extended;
-            
-            // Send ServiceDiscoveryResponse to EV
-            global_streamEncPos = 0;
-            projectExiConnector_encode_DinExiDocument();
-            addV2GTPHeaderAndTransmit(global_streamEnc.data, global_streamEncPos);
-            fsmState = stateWaitForServicePaymentSelectionRequest;
-
-        }    
-     
-    } else if (fsmState == stateWaitForServicePaymentSelectionRequest) {
-
-        routeDecoderInputData();
-        projectExiConnector_decode_DinExiDocument();      // Decode EXI
-        tcp_rxdataLen = 0; /* mark the input data as "consumed" */
-                
-        // Check if we have received the correct message
-        if (dinDocDec.V2G_Message.Body.ServicePaymentSelectionReq_isUsed) {
+/* DIN 70121 *****************************************************************************************************/
 
-            WebSerial.printf("ServicePaymentSelectionReqest\n");
+uint8_t dinMessage(void) {
+    struct dinBodyType *body = &dinDocDec.V2G_Message.Body;
 
-            if (dinDocDec.V2G_Message.Body.ServicePaymentSelectionReq.SelectedPaymentOption == dinpaymentOptionType_ExternalPayment) {
-                WebSerial.printf("OK. External Payment Selected\n");
+    if (body->CurrentDemandReq_isUsed) return V2G_MSG_CURRENTDEMAND; // the most frequent one first
+    if (body->SessionSetupReq_isUsed) return V2G_MSG_SESSIONSETUP;
+    if (body->ServiceDiscoveryReq_isUsed) return V2G_MSG_SERVICEDISCOVERY;
+    if (body->ServiceDetailReq_isUsed) return V2G_MSG_SERVICEDETAIL;
+    if (body->ServicePaymentSelectionReq_isUsed) return V2G_MSG_PAYMENTSELECTION;
+    if (body->ContractAuthenticationReq_isUsed) return V2G_MSG_AUTHORIZATION;
+    if (body->ChargeParameterDiscoveryReq_isUsed) return V2G_MSG_CHARGEPARAMETERDISCOVERY;
+    if (body->CableCheckReq_isUsed) return V2G_MSG_CABLECHECK;
+    if (body->PreChargeReq_isUsed) return V2G_MSG_PRECHARGE;
+    if (body->PowerDeliveryReq_isUsed) {
+        return body->PowerDeliveryReq.ReadyToChargeState ? V2G_MSG_POWERDELIVERY_START : V2G_MSG_POWERDELIVERY_STOP;
+    }
+    if (body->ChargingStatusReq_isUsed) return V2G_MSG_CHARGINGSTATUS;
+    if (body->MeteringReceiptReq_isUsed) return V2G_MSG_METERINGRECEIPT;
+    if (body->WeldingDetectionReq_isUsed) return V2G_MSG_WELDINGDETECTION;
+    if (body->SessionStopReq_isUsed) return V2G_MSG_SESSIONSTOP;
+    return V2G_MSG_NONE; // the certificate messages, which need TLS
+}
 
-                // Now prepare the 'ServicePaymentSelectionResponse' message to send back to the EV
-                projectExiConnector_prepare_DinExiDocument();
-                 
-                dinDocEnc.V2G_Message.Body.ServicePaymentSelectionRes_isUsed = 1;
-                init_dinServicePaymentSelectionResType(&dinDocEnc.V2G_Message.Body.ServicePaymentSelectionRes);
+void fillDinChargeParameterDiscoveryRes(struct dinChargeParameterDiscoveryResType *res) {
+    init_dinChargeParameterDiscoveryResType(res);
+    res->ResponseCode = dinresponseCodeType_OK;
+    res->EVSEProcessing = dinEVSEProcessingType_Finished;
+
+    // one schedule for the whole day, which does not limit the power. The DC limits below apply.
+    res->SAScheduleList_isUsed = 1;
+    res->SAScheduleList.SAScheduleTuple.arrayLen = 1;
+    struct dinSAScheduleTupleType *tuple = &res->SAScheduleList.SAScheduleTuple.array[0];
+    tuple->SAScheduleTupleID = 1;
+    tuple->SalesTariff_isUsed = 0;
+    tuple->PMaxSchedule.PMaxScheduleID = 1;
+    tuple->PMaxSchedule.PMaxScheduleEntry.arrayLen = 1;
+    tuple->PMaxSchedule.PMaxScheduleEntry.array[0].PMax = INT16_MAX;
+    tuple->PMaxSchedule.PMaxScheduleEntry.array[0].TimeInterval_isUsed = 0;
+    tuple->PMaxSchedule.PMaxScheduleEntry.array[0].RelativeTimeInterval_isUsed = 1;
+    tuple->PMaxSchedule.PMaxScheduleEntry.array[0].RelativeTimeInterval.start = 0;
+    tuple->PMaxSchedule.PMaxScheduleEntry.array[0].RelativeTimeInterval.duration = 86400;
+    tuple->PMaxSchedule.PMaxScheduleEntry.array[0].RelativeTimeInterval.duration_isUsed = 1;
+
+    res->DC_EVSEChargeParameter_isUsed = 1;
+    struct dinDC_EVSEChargeParameterType *dc = &res->DC_EVSEChargeParameter;
+    init_dinDC_EVSEChargeParameterType(dc);
+    setDinEVSEStatus(&dc->DC_EVSEStatus, 0); // the isolation is checked in the CableCheck
+    setDinPhysicalValue(&dc->EVSEMaximumCurrentLimit, EVSE_MAXIMUM_CURRENT, dinunitSymbolType_A);
+    setDinPhysicalValue(&dc->EVSEMaximumPowerLimit, EVSE_MAXIMUM_POWER, dinunitSymbolType_W);
+    dc->EVSEMaximumPowerLimit_isUsed = 1;
+    setDinPhysicalValue(&dc->EVSEMaximumVoltageLimit, EVSE_MAXIMUM_VOLTAGE, dinunitSymbolType_V);
+    setDinPhysicalValue(&dc->EVSEMinimumCurrentLimit, EVSE_MINIMUM_CURRENT, dinunitSymbolType_A);
+    setDinPhysicalValue(&dc->EVSEMinimumVoltageLimit, EVSE_MINIMUM_VOLTAGE, dinunitSymbolType_V);
+    setDinPhysicalValue(&dc->EVSEPeakCurrentRipple, EVSE_PEAK_CURRENT_RIPPLE, dinunitSymbolType_A);
+}
 
-                dinDocEnc.V2G_Message.Body.ServicePaymentSelectionRes.ResponseCode = dinresponseCodeType_OK;
-                
-                // Send SessionSetupResponse to EV
-                global_streamEncPos = 0;
-                projectExiConnector_encode_DinExiDocument();
-                addV2GTPHeaderAndTransmit(global_streamEnc.data, global_streamEncPos);
-                fsmState = stateWaitForContractAuthenticationRequest;
+/* The response to a request we do not accept. The FAILED_* code ends the session, so the mandatory
+   elements only need to be valid, not meaningful. */
+void sendDinFailedResponse(uint8_t message, dinresponseCodeType responseCode) {
+    struct dinBodyType *body = &dinDocEnc.V2G_Message.Body;
+
+    projectExiConnector_prepare_DinExiDocument();
+#define DIN_FAILED_RES(element) \
+    body->element##_isUsed = 1; init_din##element##Type(&body->element); body->element.ResponseCode = responseCode
+    switch (message) {
+    case V2G_MSG_SESSIONSETUP: DIN_FAILED_RES(SessionSetupRes); break;
+    case V2G_MSG_SERVICEDISCOVERY:
+        DIN_FAILED_RES(ServiceDiscoveryRes);
+        body->ServiceDiscoveryRes.PaymentOptions.PaymentOption.arrayLen = 1;
+        body->ServiceDiscoveryRes.PaymentOptions.PaymentOption.array[0] = dinpaymentOptionType_ExternalPayment;
+        break;
+    case V2G_MSG_SERVICEDETAIL: DIN_FAILED_RES(ServiceDetailRes); break;
+    case V2G_MSG_PAYMENTSELECTION: DIN_FAILED_RES(ServicePaymentSelectionRes); break;
+    case V2G_MSG_AUTHORIZATION: DIN_FAILED_RES(ContractAuthenticationRes); break;
+    case V2G_MSG_CHARGEPARAMETERDISCOVERY:
+        body->ChargeParameterDiscoveryRes_isUsed = 1;
+        fillDinChargeParameterDiscoveryRes(&body->ChargeParameterDiscoveryRes);
+        body->ChargeParameterDiscoveryRes.ResponseCode = responseCode;
+        break;
+    case V2G_MSG_CABLECHECK: DIN_FAILED_RES(CableCheckRes); break;
+    case V2G_MSG_PRECHARGE: DIN_FAILED_RES(PreChargeRes); break;
+    case V2G_MSG_POWERDELIVERY_START:
+    case V2G_MSG_POWERDELIVERY_STOP:
+        DIN_FAILED_RES(PowerDeliveryRes);
+        body->PowerDeliveryRes.DC_EVSEStatus_isUsed = 1;
+        break;
+    case V2G_MSG_CURRENTDEMAND: DIN_FAILED_RES(CurrentDemandRes); break;
+    case V2G_MSG_CHARGINGSTATUS: DIN_FAILED_RES(ChargingStatusRes); break;
+    case V2G_MSG_METERINGRECEIPT: DIN_FAILED_RES(MeteringReceiptRes); break;
+    case V2G_MSG_WELDINGDETECTION: DIN_FAILED_RES(WeldingDetectionRes); break;
+    case V2G_MSG_SESSIONSTOP: DIN_FAILED_RES(SessionStopRes); break;
+    default: return;
+    }
+#undef DIN_FAILED_RES
+    projectExiConnector_encode_DinExiDocument();
+    if (g_errn == 0) addV2GTPHeaderAndTransmit(global_streamEnc.data, global_streamEncPos);
+}
+
+uint8_t handleDinSessionSetupRequest(void) {
+    uint16_t i;
+    uint8_t n;
+
+    WebSerial.printf("SessionSetupReqest\n");
+
+    //n = dinDocDec.V2G_Message.Header.SessionID.bytesLen;
+    //for (i=0; i< n; i++) {
+    //    WebSerial.printf("%02x", dinDocDec.V2G_Message.Header.SessionID.bytes[i] );
+    //}
+    n = dinDocDec.V2G_Message.Body.SessionSetupReq.EVCCID.bytesLen;
+    if (n>6) n=6;       // out of range check
+    WebSerial.printf("EVCCID=");
+    for (i=0; i<n; i++) {
+        EVCCID[i]= dinDocDec.V2G_Message.Body.SessionSetupReq.EVCCID.bytes[i];
+        WebSerial.printf("%02x", EVCCID[i] );
+    }
+    WebSerial.printf("\n");
+
+    sessionId[0] = 1;   // our SessionId is set up here, and used by _prepare_DinExiDocument
+    sessionId[1] = 2;   // This SessionID will be used by the EV in future communication
+    sessionId[2] = 3;
+    sessionId[3] = 4;
+    sessionIdLen = SECC_SESSIONID_LEN;
+
+    // Send SessionSetupResponse to EV. The content is constant, see projectExiConnector.c
+    projectExiConnector_encode_DinResponse(DIN_RESPONSE_SESSIONSETUPRES);
+    addV2GTPHeaderAndTransmit(global_streamEnc.data, global_streamEncPos);
+    return V2G_NEXT_STATE;
+}
+
+uint8_t handleDinServiceDiscoveryRequest(void) {
+    uint16_t i;
+    uint8_t n;
+
+    WebSerial.printf("ServiceDiscoveryReqest\n");
+    n = dinDocDec.V2G_Message.Header.SessionID.bytesLen;
+    WebSerial.printf("SessionID:");
+    for (i=0; i<n; i++) WebSerial.printf("%02x", dinDocDec.V2G_Message.Header.SessionID.bytes[i] );
+    WebSerial.printf("\n");
+
+    // Send ServiceDiscoveryResponse to EV. The content is constant, see projectExiConnector.c
+    projectExiConnector_encode_DinResponse(DIN_RESPONSE_SERVICEDISCOVERYRES);
+    addV2GTPHeaderAndTransmit(global_streamEnc.data, global_streamEncPos);
+    return V2G_NEXT_STATE;
+}
+
+uint8_t handleDinServicePaymentSelectionRequest(void) {
+    WebSerial.printf("ServicePaymentSelectionReqest\n");
+
+    if (dinDocDec.V2G_Message.Body.ServicePaymentSelectionReq.SelectedPaymentOption != dinpaymentOptionType_ExternalPayment) {
+        // we offered only ExternalPayment
+        sendDinFailedResponse(V2G_MSG_PAYMENTSELECTION, dinresponseCodeType_FAILED_PaymentSelectionInvalid);
+        return V2G_END_SESSION;
+    }
+    WebSerial.printf("OK. External Payment Selected\n");
+
+    // Send ServicePaymentSelectionResponse to EV
+    projectExiConnector_encode_DinResponse(DIN_RESPONSE_SERVICEPAYMENTSELECTIONRES);
+    addV2GTPHeaderAndTransmit(global_streamEnc.data, global_streamEncPos);
+    return V2G_NEXT_STATE;
+}
+
+uint8_t handleDinContractAuthenticationRequest(void) {
+    WebSerial.printf("ContractAuthenticationRequest\n");
+
+    // Send ContractAuthenticationResponse to EV, with EVSEProcessing 'Finished'
+    projectExiConnector_encode_DinResponse(DIN_RESPONSE_CONTRACTAUTHENTICATIONRES);
+    addV2GTPHeaderAndTransmit(global_streamEnc.data, global_streamEncPos);
+    return V2G_NEXT_STATE;
+}
+
+uint8_t handleDinChargeParameterDiscoveryRequest(void) {
+    WebSerial.printf("ChargeParameterDiscoveryRequest\n");
+	// fields which were not in the message (or an AC request) read as zero
+	struct dinProjectedChargeParameterDiscoveryReq *cpd = &dinProjDec.Body.ChargeParameterDiscoveryReq;
+
+	// Current SoC (State of Charge)
+	EVSOC = cpd->EVRESSSOC;
+
+	// Target SoC
+	uint8_t full_soc = cpd->FullSOC;
+
+
+	// Energy Request
+	int8_t req_mult = cpd->EVEnergyRequest.Multiplier;
+	int16_t req_value = cpd->EVEnergyRequest.Value;
+	float energy_request = (float)req_value * pow(10, req_mult);
+
+
+	// Energy Capacity
+	int8_t cap_mult = cpd->EVEnergyCapacity.Multiplier;
+	int16_t cap_value = cpd->EVEnergyCapacity.Value;
+	float energy_capacity = (float)cap_value * pow(10, cap_mult);
+
+
+	if (!socRefresh_received(EVSOC)) recordSocTime(); // a refresh is no plug-in
+
+    // Now prepare the 'ChargeParameterDiscoveryResponse' message to send back to the EV.
+    // Only reading the SoC, it asks the EV to stop: the status says EVSE_Shutdown with StopCharging.
+    v2gStopCharging = socOnlySession;
+    projectExiConnector_prepare_DinExiDocument();
+    dinDocEnc.V2G_Message.Body.ChargeParameterDiscoveryRes_isUsed = 1;
+    fillDinChargeParameterDiscoveryRes(&dinDocEnc.V2G_Message.Body.ChargeParameterDiscoveryRes);
+
+    // Send ChargeParameterDiscoveryResponse to EV, before the SoC callback, which waits for the HTTP server
+    projectExiConnector_encode_DinExiDocument();
+    addV2GTPHeaderAndTransmit(global_streamEnc.data, global_streamEncPos);
+    reportChargeParameters(full_soc, energy_request, energy_capacity);
+    return socOnlySession ? V2G_STOP_SESSION : V2G_NEXT_STATE;
+}
+
+uint8_t handleDinCableCheckRequest(void) {
+    WebSerial.printf("CableCheckRequest\n");
+    EVSOC = dinDocDec.V2G_Message.Body.CableCheckReq.DC_EVStatus.EVRESSSOC;
+
+    // Send CableCheckResponse to EV, the isolation is fine and the check Finished. An EV which did not
+    // see our StopCharging keeps hearing it, with a check that does not finish. After V2G_STOP_TIMEOUT_MS
+    // we close the connection, see checkV2GTimeouts().
+    projectExiConnector_prepare_DinExiDocument();
+    dinDocEnc.V2G_Message.Body.CableCheckRes_isUsed = 1;
+    init_dinCableCheckResType(&dinDocEnc.V2G_Message.Body.CableCheckRes);
+    dinDocEnc.V2G_Message.Body.CableCheckRes.ResponseCode = dinresponseCodeType_OK;
+    setDinEVSEStatus(&dinDocEnc.V2G_Message.Body.CableCheckRes.DC_EVSEStatus, 1);
+    dinDocEnc.V2G_Message.Body.CableCheckRes.EVSEProcessing = v2gStopCharging ? dinEVSEProcessingType_Ongoing : dinEVSEProcessingType_Finished;
+    projectExiConnector_encode_DinExiDocument();
+    addV2GTPHeaderAndTransmit(global_streamEnc.data, global_streamEncPos);
+    return V2G_NEXT_STATE;
+}
+
+uint8_t handleDinPreChargeRequest(void) {
+    struct dinPreChargeReqType *pc = &dinDocDec.V2G_Message.Body.PreChargeReq;
+
+    // read the request before the response takes its memory
+    EVSOC = pc->DC_EVStatus.EVRESSSOC;
+    powerStage_setTarget(dinPhysicalValue(&pc->EVTargetVoltage), dinPhysicalValue(&pc->EVTargetCurrent));
+    WebSerial.printf("PreChargeRequest, EVSE at %.0f V\n", EVSEPresentVoltage);
+
+    projectExiConnector_prepare_DinExiDocument();
+    dinDocEnc.V2G_Message.Body.PreChargeRes_isUsed = 1;
+    init_dinPreChargeResType(&dinDocEnc.V2G_Message.Body.PreChargeRes);
+    dinDocEnc.V2G_Message.Body.PreChargeRes.ResponseCode = dinresponseCodeType_OK;
+    setDinEVSEStatus(&dinDocEnc.V2G_Message.Body.PreChargeRes.DC_EVSEStatus, 1);
+    setDinPhysicalValue(&dinDocEnc.V2G_Message.Body.PreChargeRes.EVSEPresentVoltage, EVSEPresentVoltage, dinunitSymbolType_V);
+    projectExiConnector_encode_DinExiDocument();
+    addV2GTPHeaderAndTransmit(global_streamEnc.data, global_streamEncPos);
+    return V2G_NEXT_STATE;
+}
+
+uint8_t handleDinPowerDeliveryRequest(void) {
+    uint8_t readyToCharge = dinDocDec.V2G_Message.Body.PowerDeliveryReq.ReadyToChargeState;
+
+    WebSerial.printf("PowerDeliveryRequest, %s\n", readyToCharge ? "start" : "stop");
+    if (!readyToCharge) powerStage_setTarget(0, 0);
+
+    projectExiConnector_prepare_DinExiDocument();
+    dinDocEnc.V2G_Message.Body.PowerDeliveryRes_isUsed = 1;
+    init_dinPowerDeliveryResType(&dinDocEnc.V2G_Message.Body.PowerDeliveryRes);
+    dinDocEnc.V2G_Message.Body.PowerDeliveryRes.ResponseCode = dinresponseCodeType_OK;
+    dinDocEnc.V2G_Message.Body.PowerDeliveryRes.DC_EVSEStatus_isUsed = 1;
+    setDinEVSEStatus(&dinDocEnc.V2G_Message.Body.PowerDeliveryRes.DC_EVSEStatus, 1);
+    projectExiConnector_encode_DinExiDocument();
+    addV2GTPHeaderAndTransmit(global_streamEnc.data, global_streamEncPos);
+
+    if (readyToCharge) {
+        memset(&currentDemandLatency, 0, sizeof(currentDemandLatency));
+        currentDemandSpeculated = 0; // the first template is built after this exchange
+        v2gHotPath = 1;
+    } else {
+        v2gHotPath = 0;
+        reportLatency("CurrentDemand", &currentDemandLatency);
+    }
+    return V2G_NEXT_STATE;
+}
+
+uint8_t samePhysicalValue(const struct dinPhysicalValueType *a, const struct dinPhysicalValueType *b) {
+    return a->Value == b->Value && a->Multiplier == b->Multiplier;
+}
+
+void fillDinCurrentDemandRes(struct dinBodyType *body) {
+    struct dinCurrentDemandResType *res = &body->CurrentDemandRes;
+
+    body->CurrentDemandRes_isUsed = 1;
+    init_dinCurrentDemandResType(res);
+    res->ResponseCode = dinresponseCodeType_OK;
+    setDinEVSEStatus(&res->DC_EVSEStatus, 1);
+    setDinPhysicalValue(&res->EVSEPresentVoltage, EVSEPresentVoltage, dinunitSymbolType_V);
+    setDinPhysicalValue(&res->EVSEPresentCurrent, EVSEPresentCurrent, dinunitSymbolType_A);
+    res->EVSECurrentLimitAchieved = 0;
+    res->EVSEVoltageLimitAchieved = 0;
+    res->EVSEPowerLimitAchieved = 0;
+    setDinPhysicalValue(&res->EVSEMaximumVoltageLimit, EVSE_MAXIMUM_VOLTAGE, dinunitSymbolType_V);
+    res->EVSEMaximumVoltageLimit_isUsed = 1;
+    setDinPhysicalValue(&res->EVSEMaximumCurrentLimit, EVSE_MAXIMUM_CURRENT, dinunitSymbolType_A);
+    res->EVSEMaximumCurrentLimit_isUsed = 1;
+    setDinPhysicalValue(&res->EVSEMaximumPowerLimit, EVSE_MAXIMUM_POWER, dinunitSymbolType_W);
+    res->EVSEMaximumPowerLimit_isUsed = 1;
+}
+
+/* Called by the Timer20ms task, between the requests. Encodes the next CurrentDemandRes whenever the present
+   values change, so the request only has to patch in the SessionID. */
+void updateSpeculativeResponses(void) {
+    struct dinPhysicalValueType voltage, current;
+
+    if (!v2gHotPath || v2gProtocol != APPHAND_PROTOCOL_DIN) return;
+    setDinPhysicalValue(&voltage, EVSEPresentVoltage, dinunitSymbolType_V);
+    setDinPhysicalValue(&current, EVSEPresentCurrent, dinunitSymbolType_A);
+    if (currentDemandSpeculated && samePhysicalValue(&voltage, &speculatedVoltage) && samePhysicalValue(&current, &speculatedCurrent)) return;
+    // fails while a request is in the arena, then we try again in the next cycle
+    currentDemandSpeculated = projectExiConnector_buildSpeculativeDinResponse(DIN_SPECULATIVE_CURRENTDEMANDRES, fillDinCurrentDemandRes);
+    speculatedVoltage = voltage;
+    speculatedCurrent = current;
+}
+
+/* The hot path: every ~100ms for the whole charge. No logging here, the latency is reported when the loop ends. */
+uint8_t handleDinCurrentDemandRequest(void) {
+    struct dinCurrentDemandReqType *cd = &dinDocDec.V2G_Message.Body.CurrentDemandReq;
+    struct dinPhysicalValueType voltage, current;
+
+    // read the request before the response takes its memory
+    EVSOC = cd->DC_EVStatus.EVRESSSOC;
+    powerStage_setTarget(dinPhysicalValue(&cd->EVTargetVoltage), dinPhysicalValue(&cd->EVTargetCurrent));
+
+    // the pre-encoded response, if the present values are still the ones it says
+    setDinPhysicalValue(&voltage, EVSEPresentVoltage, dinunitSymbolType_V);
+    setDinPhysicalValue(&current, EVSEPresentCurrent, dinunitSymbolType_A);
+    if (currentDemandSpeculated && samePhysicalValue(&voltage, &speculatedVoltage) && samePhysicalValue(&current, &speculatedCurrent)
+        && projectExiConnector_encode_SpeculativeDinResponse(DIN_SPECULATIVE_CURRENTDEMANDRES)) {
+        currentDemandLatency.preEncoded++;
+    } else {
+        projectExiConnector_prepare_DinExiDocument();
+        fillDinCurrentDemandRes(&dinDocEnc.V2G_Message.Body);
+        projectExiConnector_encode_DinExiDocument();
+    }
+    addV2GTPHeaderAndTransmit(global_streamEnc.data, global_streamEncPos);
+    recordLatency(&currentDemandLatency);
+    return V2G_NEXT_STATE;
+}
+
+uint8_t handleDinWeldingDetectionRequest(void) {
+    WebSerial.printf("WeldingDetectionRequest\n");
+    projectExiConnector_prepare_DinExiDocument();
+    dinDocEnc.V2G_Message.Body.WeldingDetectionRes_isUsed = 1;
+    init_dinWeldingDetectionResType(&dinDocEnc.V2G_Message.Body.WeldingDetectionRes);
+    dinDocEnc.V2G_Message.Body.WeldingDetectionRes.ResponseCode = dinresponseCodeType_OK;
+    setDinEVSEStatus(&dinDocEnc.V2G_Message.Body.WeldingDetectionRes.DC_EVSEStatus, 1);
+    setDinPhysicalValue(&dinDocEnc.V2G_Message.Body.WeldingDetectionRes.EVSEPresentVoltage, EVSEPresentVoltage, dinunitSymbolType_V);
+    projectExiConnector_encode_DinExiDocument();
+    addV2GTPHeaderAndTransmit(global_streamEnc.data, global_streamEncPos);
+    return V2G_NEXT_STATE;
+}
+
+uint8_t handleDinSessionStopRequest(void) {
+    WebSerial.printf("SessionStopRequest\n");
+    projectExiConnector_prepare_DinExiDocument();
+    dinDocEnc.V2G_Message.Body.SessionStopRes_isUsed = 1;
+    init_dinSessionStopResType(&dinDocEnc.V2G_Message.Body.SessionStopRes);
+    dinDocEnc.V2G_Message.Body.SessionStopRes.ResponseCode = dinresponseCodeType_OK;
+    projectExiConnector_encode_DinExiDocument();
+    addV2GTPHeaderAndTransmit(global_streamEnc.data, global_streamEncPos);
+    return V2G_END_SESSION;
+}
+
+
+
+
+/* The session state machine *************************************************************************************/
+/* One row per request the SECC accepts in a state. A request without a row is out of sequence: it gets its
+   response with FAILED_SequenceError, and the session ends. A new message or protocol is a new row. */
+
+struct v2gTransition {
+    uint8_t protocol;  // APPHAND_PROTOCOL_*, or V2G_ANY_PROTOCOL
+    uint8_t state;     // in which the request is accepted
+    uint8_t message;   // V2G_MSG_*
+    uint8_t (*handler)(void); // sends the response. V2G_NEXT_STATE, or V2G_END_SESSION
+    uint8_t nextState;
+    uint32_t timeoutMs; // for the next request, 0 for none
+};
+
+const struct v2gTransition v2gTransitions[] = {
+    { V2G_ANY_PROTOCOL, stateWaitForSupportedApplicationProtocolRequest, V2G_MSG_SUPPORTEDAPPPROTOCOL,
+        handleSupportedAppProtocolRequest, stateWaitForSessionSetupRequest, V2G_SECC_COMMUNICATIONSETUP_TIMEOUT_MS },
+
+    { APPHAND_PROTOCOL_DIN, stateWaitForSessionSetupRequest, V2G_MSG_SESSIONSETUP,
+        handleDinSessionSetupRequest, stateWaitForServiceDiscoveryRequest, V2G_SECC_SEQUENCE_TIMEOUT_MS },
+    { APPHAND_PROTOCOL_DIN, stateWaitForServiceDiscoveryRequest, V2G_MSG_SERVICEDISCOVERY,
+        handleDinServiceDiscoveryRequest, stateWaitForServicePaymentSelectionRequest, V2G_SECC_SEQUENCE_TIMEOUT_MS },
+    { APPHAND_PROTOCOL_DIN, stateWaitForServicePaymentSelectionRequest, V2G_MSG_PAYMENTSELECTION,
+        handleDinServicePaymentSelectionRequest, stateWaitForContractAuthenticationRequest, V2G_SECC_SEQUENCE_TIMEOUT_MS },
+    { APPHAND_PROTOCOL_DIN, stateWaitForContractAuthenticationRequest, V2G_MSG_AUTHORIZATION,
+        handleDinContractAuthenticationRequest, stateWaitForChargeParameterDiscoveryRequest, V2G_SECC_SEQUENCE_TIMEOUT_MS },
+    { APPHAND_PROTOCOL_DIN, stateWaitForChargeParameterDiscoveryRequest, V2G_MSG_CHARGEPARAMETERDISCOVERY,
+        handleDinChargeParameterDiscoveryRequest, stateWaitForCableCheckRequest, V2G_SECC_SEQUENCE_TIMEOUT_MS },
+    { APPHAND_PROTOCOL_DIN, stateWaitForCableCheckRequest, V2G_MSG_CABLECHECK,
+        handleDinCableCheckRequest, stateWaitForPreChargeRequest, V2G_SECC_SEQUENCE_TIMEOUT_MS },
+    // The EV repeats the PreChargeReq until its own measurement matches, then it asks for power.
+    { APPHAND_PROTOCOL_DIN, stateWaitForPreChargeRequest, V2G_MSG_PRECHARGE,
+        handleDinPreChargeRequest, stateWaitForPowerDeliveryRequest, V2G_SECC_SEQUENCE_TIMEOUT_MS },
+    { APPHAND_PROTOCOL_DIN, stateWaitForPowerDeliveryRequest, V2G_MSG_PRECHARGE,
+        handleDinPreChargeRequest, stateWaitForPowerDeliveryRequest, V2G_SECC_SEQUENCE_TIMEOUT_MS },
+    { APPHAND_PROTOCOL_DIN, stateWaitForPowerDeliveryRequest, V2G_MSG_POWERDELIVERY_START,
+        handleDinPowerDeliveryRequest, stateWaitForCurrentDemandRequest, V2G_SECC_SEQUENCE_TIMEOUT_MS },
+    { APPHAND_PROTOCOL_DIN, stateWaitForCurrentDemandRequest, V2G_MSG_CURRENTDEMAND,
+        handleDinCurrentDemandRequest, stateWaitForCurrentDemandRequest, V2G_SECC_SEQUENCE_TIMEOUT_MS },
+    { APPHAND_PROTOCOL_DIN, stateWaitForCurrentDemandRequest, V2G_MSG_POWERDELIVERY_STOP,
+        handleDinPowerDeliveryRequest, stateWaitForWeldingDetectionRequest, V2G_SECC_SEQUENCE_TIMEOUT_MS },
+    { APPHAND_PROTOCOL_DIN, stateWaitForWeldingDetectionRequest, V2G_MSG_WELDINGDETECTION,
+        handleDinWeldingDetectionRequest, stateWaitForWeldingDetectionRequest, V2G_SECC_SEQUENCE_TIMEOUT_MS },
+    { APPHAND_PROTOCOL_DIN, stateWaitForWeldingDetectionRequest, V2G_MSG_SESSIONSTOP,
+        handleDinSessionStopRequest, stateWaitForSupportedApplicationProtocolRequest, 0 },
+    // after a V2G_STOP_SESSION. EVs differ in how they leave, all of these end without an error.
+    { APPHAND_PROTOCOL_DIN, stateWaitForSessionStopRequest, V2G_MSG_POWERDELIVERY_STOP,
+        handleDinPowerDeliveryRequest, stateWaitForSessionStopRequest, V2G_SECC_SEQUENCE_TIMEOUT_MS },
+    { APPHAND_PROTOCOL_DIN, stateWaitForSessionStopRequest, V2G_MSG_CABLECHECK,
+        handleDinCableCheckRequest, stateWaitForSessionStopRequest, V2G_SECC_SEQUENCE_TIMEOUT_MS },
+    { APPHAND_PROTOCOL_DIN, stateWaitForSessionStopRequest, V2G_MSG_SESSIONSTOP,
+        handleDinSessionStopRequest, stateWaitForSupportedApplicationProtocolRequest, 0 },
+
+};
+
+#define V2G_TRANSITIONS (sizeof(v2gTransitions) / sizeof(v2gTransitions[0]))
+
+/* row index + 1 per protocol, state and message, 0 when the message is out of sequence. Built from v2gTransitions. */
+uint8_t v2gDispatch[APPHAND_PROTOCOLS][V2G_STATES][V2G_MSGS];
+
+void buildV2GDispatchTable(void) {
+    uint8_t i, p;
+
+    memset(v2gDispatch, 0, sizeof(v2gDispatch));
+    for (i = 0; i < V2G_TRANSITIONS; i++) {
+        for (p = 0; p < APPHAND_PROTOCOLS; p++) {
+            if (v2gTransitions[i].protocol == p || v2gTransitions[i].protocol == V2G_ANY_PROTOCOL) {
+                v2gDispatch[p][v2gTransitions[i].state][v2gTransitions[i].message] = i + 1;
             }
         }
-    } else if (fsmState == stateWaitForContractAuthenticationRequest) {
+    }
+}
+
+/* What the decoder found. decodeKind is the getDecodeKind() the message was decoded with. */
+uint8_t receivedMessage(uint8_t decodeKind) {
+    if (g_errn != 0) return V2G_MSG_NONE;
+    switch (decodeKind) {
+    case EXI_DECODE_APPHAND:
+        return aphsDoc.supportedAppProtocolReq_isUsed ? V2G_MSG_SUPPORTEDAPPPROTOCOL : V2G_MSG_NONE;
+    case EXI_DECODE_DIN_PROJECTED:
+        if (dinProjDec.bodyElement == DIN_PROJ_BODY_CHARGEPARAMETERDISCOVERYREQ) return V2G_MSG_CHARGEPARAMETERDISCOVERY;
+        return dinMessage(); // another message, the projection decoded it in full
+    case EXI_DECODE_DIN:
+        return dinMessage();
+    }
+    return V2G_MSG_NONE;
+}
+
+void sendFailedResponse(uint8_t message) {
+    if (message == V2G_MSG_SUPPORTEDAPPPROTOCOL) {
+        projectExiConnector_encode_appHandResponse(appHandresponseCodeType_Failed_NoNegotiation, 0);
+        addV2GTPHeaderAndTransmit(global_streamEnc.data, global_streamEncPos);
+    } else {
+        sendDinFailedResponse(message, dinresponseCodeType_FAILED_SequenceError);
+    }
+}
+
+
+/* Gives the EXI stream of the received message to the decoder getDecodeKind() selected. */
+void decodeExiMessage(uint8_t decodeKind) {
+    switch (decodeKind) {
+    case EXI_DECODE_APPHAND:
+        projectExiConnector_decode_appHandExiDocument();
+        break;
+    case EXI_DECODE_DIN_PROJECTED:
+        projectExiConnector_decode_DinProjectedExiDocument(CPD_PROJECTED_FIELDS);
+        break;
+    case EXI_DECODE_DIN:
+        projectExiConnector_decode_DinExiDocument();
+        break;
+    }
+}
+
+/* Answers the decoded request, and moves the session to its next state. */
+void handleV2GMessage(uint8_t decodeKind) {
+
+    uint8_t message, row;
+
+    message = receivedMessage(decodeKind);
+    if (message == V2G_MSG_NONE) {
+        WebSerial.printf("[V2G] ignoring a message we cannot decode in %s, errn %d\n", v2gStateNames[fsmState], g_errn);
+    } else if ((row = v2gDispatch[v2gProtocol][fsmState][message]) == 0) {
+        WebSerial.printf("[V2G] %s request out of sequence in %s\n", v2gMessageNames[message], v2gStateNames[fsmState]);
+        sendFailedResponse(message);
+        recoverFrom(RECOVER_V2G, "FAILED_SequenceError");
+    } else {
+        switch (v2gTransitions[row - 1].handler()) {
+        case V2G_END_SESSION:
+            endV2GSession(v2gMessageNames[message]);
+            break;
+        case V2G_STOP_SESSION:
+            enterV2GState(stateWaitForSessionStopRequest, V2G_SECC_SEQUENCE_TIMEOUT_MS);
+            break;
+        default:
+            enterV2GState(v2gTransitions[row - 1].nextState, v2gTransitions[row - 1].timeoutMs);
+        }
+    }
+    projectExiConnector_resetArena(); // request and response are done with the EXI documents
+}
 
-        routeDecoderInputData();
-        projectExiConnector_decode_DinExiDocument();      // Decode EXI
-        tcp_rxdataLen = 0; /* mark the input data as "consumed" */
-                
-        // Check if we have received the correct message
-        if (dinDocDec.V2G_Message.Body.ContractAuthenticationReq_isUsed) {
-
-            WebSerial.printf("ContractAuthenticationRequest\n");
-
-            // Now prepare the 'ContractAuthenticationResponse' message to send back to the EV
-            projectExiConnector_prepare_DinExiDocument();
-                        
-            dinDocEnc.V2G_Message.Body.ContractAuthenticationRes_isUsed = 1;
-            // Set Authorisation immediately to 'Finished'.
-            dinDocEnc.V2G_Message.Body.ContractAuthenticationRes.EVSEProcessing = dinEVSEProcessingType_Finished;
-            init_dinContractAuthenticationResType(&dinDocEnc.V2G_Message.Body.ContractAuthenticationRes);
-            
-            // Send SessionSetupResponse to EV
-            global_streamEncPos = 0;
-            projectExiConnector_encode_DinExiDocument();
-            addV2GTPHeaderAndTransmit(global_streamEnc.data, global_streamEncPos);
-            fsmState = stateWaitForChargeParameterDiscoveryRequest;
-        }    
-
-    } else if (fsmState == stateWaitForChargeParameterDiscoveryRequest) {
-
-        routeDecoderInputData();
-        projectExiConnector_decode_DinExiDocument();      // Decode EXI
-        tcp_rxdataLen = 0; /* mark the input data as "consumed" */
-                
-        // Check if we have received the correct message
-        if (dinDocDec.V2G_Message.Body.ChargeParameterDiscoveryReq_isUsed) {
-
-            WebSerial.printf("ChargeParameterDiscoveryRequest\n");
-			
-			// Current SoC (State of Charge)
-			EVSOC = dinDocDec.V2G_Message.Body.ChargeParameterDiscoveryReq.DC_EVChargeParameter.DC_EVStatus.EVRESSSOC;
-			
-			// Target SoC
-			uint8_t full_soc = dinDocDec.V2G_Message.Body.ChargeParameterDiscoveryReq.DC_EVChargeParameter.FullSOC;
-			
-			
-			// Energy Request
-			int8_t req_mult = dinDocDec.V2G_Message.Body.ChargeParameterDiscoveryReq.DC_EVChargeParameter.EVEnergyRequest.Multiplier;
-			int16_t req_value = dinDocDec.V2G_Message.Body.ChargeParameterDiscoveryReq.DC_EVChargeParameter.EVEnergyRequest.Value;
-			float energy_request = (float)req_value * pow(10, req_mult);
-			
-			
-			// Energy Capacity
-			int8_t cap_mult = dinDocDec.V2G_Message.Body.ChargeParameterDiscoveryReq.DC_EVChargeParameter.EVEnergyCapacity.Multiplier;
-			int16_t cap_value = dinDocDec.V2G_Message.Body.ChargeParameterDiscoveryReq.DC_EVChargeParameter.EVEnergyCapacity.Value;
-			float energy_capacity = (float)cap_value * pow(10, cap_mult);
-			
-
-			WebSerial.printf("Current SoC %d%%\n", EVSOC);
-			WebSerial.printf("Target SoC %d%%\n", full_soc);
-			WebSerial.printf("Energy Request: %.0f Wh\n", energy_request);
-			WebSerial.printf("Energy Capacity: %.0f Wh\n", energy_capacity);
-			
-			String evccid_string = macArrayToString(EVCCID);
-        
-			sendSocCallback(
-				(float)EVSOC,           // Current SoC (uint8_t -> float)
-				(float)full_soc,        // Target SoC (uint8_t -> float)
-				energy_capacity,        // Energy Capacity (float)
-				energy_request,         // Energy Request (float)
-				evccid_string           // EVCCID String
-			);
-            // Now prepare the 'ChargeParameterDiscoveryResponse' message to send back to the EV
-            projectExiConnector_prepare_DinExiDocument();
-            
-            dinDocEnc.V2G_Message.Body.ChargeParameterDiscoveryRes_isUsed = 1;   
-            init_dinChargeParameterDiscoveryResType(&dinDocEnc.V2G_Message.Body.ChargeParameterDiscoveryRes);
-            
-            // Send SessionSetupResponse to EV
-            global_streamEncPos = 0;
-            projectExiConnector_encode_DinExiDocument();
-            addV2GTPHeaderAndTransmit(global_streamEnc.data, global_streamEncPos);
-            fsmState = stateWaitForCableCheckRequest;
-
-        }    
+void decodeV2GTP(void) {
 
+    uint32_t exiLen;
+    uint16_t payloadType, msgLen;
+    uint8_t isExi, decodeKind = EXI_DECODE_APPHAND;
+
+    /* tcp_rxdata collects the received segments. A V2GTP message may span several segments, and the EV may
+       send its next message right behind one. The V2GTP header tells where each message ends: a complete
+       message is decoded in one go, the bytes behind it stay in tcp_rxdata for the next round. */
+    while (tcp_rxdataLen >= V2GTP_HEADER_SIZE) {
+        exiLen = ((uint32_t)tcp_rxdata[4] << 24) | ((uint32_t)tcp_rxdata[5] << 16) | ((uint32_t)tcp_rxdata[6] << 8) | tcp_rxdata[7];
+        if (exiLen > TCP_RX_DATA_LEN - V2GTP_HEADER_SIZE) {
+            WebSerial.printf("Error: V2GTP message does not fit into tcp_rxdata.\n");
+            tcp_rxdataLen = 0;
+            return;
+        }
+        msgLen = V2GTP_HEADER_SIZE + exiLen;
+        if (tcp_rxdataLen < msgLen) return; /* wait for the next segment, it is appended to tcp_rxdata */
+        payloadType = ((uint16_t)tcp_rxdata[2] << 8) | tcp_rxdata[3];
+        isExi = tcp_rxdata[0] == 0x01 && tcp_rxdata[1] == 0xfe && payloadType == V2GTP_PAYLOAD_EXI;
+        if (!isExi) {
+            /* e.g. an ISO 15118-20 message set, which we have no codec for. Drop it. */
+            WebSerial.printf("V2GTP payload type %04x is not supported.\n", payloadType);
+        } else {
+            routeDecoderInputData(exiLen);
+            decodeKind = getDecodeKind();
+            decodeExiMessage(decodeKind);
+        }
+        /* mark the message as "consumed". The decoded document holds copies of its values. */
+        tcp_rxdataLen -= msgLen;
+        memmove(tcp_rxdata, tcp_rxdata + msgLen, tcp_rxdataLen);
+        if (isExi) handleV2GMessage(decodeKind); // may end the session, which empties tcp_rxdata
     }
-    
 }
 
 
 void tcp_packRequestIntoEthernet(void) {
     //# packs the IP packet into an ethernet packet
-    uint16_t i;
     uint16_t length;        
     
     length = TcpIpRequestLen + 6 + 6 + 2; // # Ethernet header needs 14 bytes:
@@ -425,7 +998,6 @@ void tcp_packRequestIntoIp(void) {
 
 
 void tcp_prepareTcpHeader(uint8_t tcpFlag) {
-    uint8_t i;
     uint16_t checksum;
 
     // # TCP header needs at least 24 bytes:
@@ -488,13 +1060,23 @@ void tcp_sendFirstAck(void) {
 }
 
 void tcp_sendAck(void) {
-   WebSerial.printf("[TCP] sending ACK\n");
+   if (!v2gHotPath) WebSerial.printf("[TCP] sending ACK\n");
    tcpHeaderLen = 20; /* 20 bytes normal header, no options */
    tcpPayloadLen = 0;   
    tcp_prepareTcpHeader(TCP_FLAG_ACK);	
    tcp_packRequestIntoIp();
 }
 
+/* The EV closes the connection, we close our side at the same time. Or we close it first, for an EV which
+   does not stop. */
+void tcp_sendFinAck(void) {
+   WebSerial.printf("[TCP] sending FIN ACK\n");
+   tcpHeaderLen = 20;
+   tcpPayloadLen = 0;
+   tcp_prepareTcpHeader(TCP_FLAG_FIN | TCP_FLAG_ACK);
+   tcp_packRequestIntoIp();
+}
+
 
 void evaluateTcpPacket(void) {
     uint8_t flags;
@@ -505,7 +1087,11 @@ void evaluateTcpPacket(void) {
     /* todo: check the IP addresses, checksum etc */
     //nTcpPacketsReceived++;
     pLen =  rxbuffer[18]*256 + rxbuffer[19]; /* length of the IP payload */
-    hdrLen = (rxbuffer[66]>>4) * 4; /* header length in byte */
+    hdrLen = (rxbuffer[66]>>4) * 4; /* header length in byte, 20 plus the options */
+    if (hdrLen < 20) {
+        WebSerial.printf("[TCP] invalid header length.\n");
+        return;
+    }
     if (pLen >= hdrLen) {
         tmpPayloadLen = pLen - hdrLen;
     } else {
@@ -532,12 +1118,19 @@ void evaluateTcpPacket(void) {
     //WebSerial.printf("Source:%u Dest:%u Seqnr:%08x Acknr:%08x flags:%02x\n", SourcePort, DestinationPort, remoteSeqNr, remoteAckNr, flags);        
     flags = rxbuffer[67];
     if (flags == TCP_FLAG_SYN) { /* This is the connection setup reqest from the EV. */
+        if (recoveryHolds(RECOVER_V2G)) return; /* no SYN-ACK before the backoff is over, the EV repeats its SYN */
+        if (tcpState != TCP_STATE_CLOSED && SourcePort != evccTcpPort) {
+            /* a new connection from another port, the EV gave up on the old one. It stays in our AVLN. */
+            resetV2GSession("new TCP connection");
+        }
         if (tcpState == TCP_STATE_CLOSED) {
             evccTcpPort = SourcePort; // update the evccTcpPort to the new TCP port
             TcpSeqNr = 0x01020304; // We start with a 'random' sequence nr
             TcpAckNr = remoteSeqNr+1; // The ACK number of our next transmit packet is one more than the received seq number.
             tcpState = TCP_STATE_SYN_ACK;
             tcp_sendFirstAck();
+            // a connection without a handshake must not block the next one
+            enterV2GState(stateWaitForSupportedApplicationProtocolRequest, V2G_SECC_COMMUNICATIONSETUP_TIMEOUT_MS);
         }
         return;
     }    
@@ -548,6 +1141,16 @@ void evaluateTcpPacket(void) {
         }
         return;
     }
+    if ((flags & (TCP_FLAG_FIN | TCP_FLAG_RST)) && SourcePort == evccTcpPort) {
+        if (flags & TCP_FLAG_FIN) {
+            // also after a SessionStop, which closed our side already
+            TcpAckNr = remoteSeqNr + tmpPayloadLen + 1; // the FIN counts as one byte
+            TcpSeqNr = remoteAckNr;
+            tcp_sendFinAck();
+        }
+        if (tcpState != TCP_STATE_CLOSED) recoverFrom(RECOVER_TCP, (flags & TCP_FLAG_RST) ? "TCP reset by the EV" : "TCP closed by the EV");
+        return;
+    }
     /* It is no connection setup. We can have the following situations here: */
     if (tcpState != TCP_STATE_ESTABLISHED) {
         /* received something while the connection is closed. Just ignore it. */
@@ -560,11 +1163,22 @@ void evaluateTcpPacket(void) {
    if ((tmpPayloadLen>0) && (tmpPayloadLen< TCP_RX_DATA_LEN)) {
         /* This is a data transfer packet. */
         // flag bit PSH should also be set.
-        tcp_rxdataLen = tmpPayloadLen;
-        TcpAckNr = remoteSeqNr + tcp_rxdataLen; // The ACK number of our next transmit packet is tcp_rxdataLen more than the received seq number.
+        if (remoteSeqNr != TcpAckNr) {
+            /* Not the segment we expect, e.g. a retransmission after our ACK got lost. Its request was answered
+               already, a second answer would be out of sequence. Ack what we have. */
+            tcp_sendAck();
+            return;
+        }
+        if (tcp_rxdataLen + tmpPayloadLen > TCP_RX_DATA_LEN) {
+            /* the message does not fit, drop it and start again with this segment */
+            tcp_rxdataLen = 0;
+        }
+        TcpAckNr = remoteSeqNr + tmpPayloadLen; // The ACK number of our next transmit packet is tmpPayloadLen more than the received seq number.
         TcpSeqNr = remoteAckNr;                 // tcp_rxdatalen will be cleared later.        
-        /* rxbuffer[74] is the first payload byte. */
-        memcpy(tcp_rxdata, rxbuffer+74, tcp_rxdataLen);  /* provide the received data to the application */
+        /* The payload follows the TCP header and its options, at rxbuffer[74] without options. Append it, a V2GTP message may span several segments. */
+        memcpy(tcp_rxdata + tcp_rxdataLen, rxbuffer+54+hdrLen, tmpPayloadLen);  /* provide the received data to the application */
+        tcp_rxdataLen += tmpPayloadLen;
+        v2gRequestMicros = micros();
         //     connMgr_TcpOk();
         tcp_sendAck();  // Send Ack, then process data
 
@@ -574,7 +1188,7 @@ void evaluateTcpPacket(void) {
     }
 
    if (flags & TCP_FLAG_ACK) {
-       WebSerial.printf("This was an ACK\n\n");
+       if (!v2gHotPath) WebSerial.printf("This was an ACK\n\n");
        //nTcpPacketsReceived+=1000;
        TcpSeqNr = remoteAckNr; /* The sequence number of our next transmit packet is given by the received ACK number. */      
    }
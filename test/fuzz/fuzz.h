@@ -0,0 +1,17 @@
+/* Fuzz targets of the protocol parsers, see the Makefile */
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+
+#define FUZZ_EXI_MAX_LEN 1000 /* the largest message the receive buffer of tcp.cpp holds */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size);
+#ifdef __cplusplus
+}
+
+void fuzz_advanceMs(unsigned long ms);
+void fuzz_forEachFrame(const uint8_t *data, size_t size, void (*frameHandler)(uint16_t rxbytes));
+#endif
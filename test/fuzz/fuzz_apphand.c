@@ -0,0 +1,22 @@
+/* supportedAppProtocolReq: the EXI decoder, then the protocol negotiation on what it decoded */
+
+#include "fuzz.h"
+#include "projectExiConnector.h"
+#include "appHandNegotiation.h"
+
+static struct exiCodecContext ctx;
+
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size) {
+	struct appHandNegotiation result;
+
+	if (size > FUZZ_EXI_MAX_LEN) return 0;
+	exiCodec_init(&ctx);
+	ctx.streamDec.data = (uint8_t *)data;
+	ctx.streamDec.size = size;
+	exiCodec_decode_appHandExiDocument(&ctx);
+	if (ctx.errn == 0 && ctx.arena.appHand.supportedAppProtocolReq_isUsed) {
+		appHand_negotiate(&ctx.arena.appHand.supportedAppProtocolReq, &result);
+	}
+	exiCodec_resetArena(&ctx);
+	return 0;
+}
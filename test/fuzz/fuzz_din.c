@@ -0,0 +1,16 @@
+/* V2G_Message of DIN 70121: the complete EXI decoder */
+
+#include "fuzz.h"
+#include "projectExiConnector.h"
+
+static struct exiCodecContext ctx;
+
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size) {
+	if (size > FUZZ_EXI_MAX_LEN) return 0;
+	exiCodec_init(&ctx);
+	ctx.streamDec.data = (uint8_t *)data;
+	ctx.streamDec.size = size;
+	exiCodec_decode_DinExiDocument(&ctx);
+	exiCodec_resetArena(&ctx);
+	return 0;
+}
@@ -0,0 +1,20 @@
+/* V2G_Message of DIN 70121: the projection decoder. The first two bytes select the fields, the rest is
+   the message. A body element which is not projected goes on to the complete decoder, as in tcp.cpp. */
+
+#include "fuzz.h"
+#include "projectExiConnector.h"
+
+static struct exiCodecContext ctx;
+
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size) {
+	uint16_t fields;
+
+	if (size < 2 || size > 2 + FUZZ_EXI_MAX_LEN) return 0;
+	fields = (data[0] << 8) | data[1];
+	exiCodec_init(&ctx);
+	ctx.streamDec.data = (uint8_t *)data + 2;
+	ctx.streamDec.size = size - 2;
+	exiCodec_decode_DinProjectedExiDocument(&ctx, fields);
+	exiCodec_resetArena(&ctx);
+	return 0;
+}
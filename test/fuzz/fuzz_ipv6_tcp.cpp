@@ -0,0 +1,35 @@
+// IPv6Manager: neighbor solicitation, SDP, and the TCP connection with the V2GTP messages it carries.
+// The first byte of the input selects a SoC-only session (bit 0, see socOnlySession), a sequence of frames
+// follows, see fuzz_forEachFrame(). Each input starts without a connection, so a SYN, its ACK and the V2G
+// messages of a session can all be in one input.
+
+#include <Arduino.h>
+#include "main.h"
+#include "ipv6.h"
+#include "tcp.h"
+#include "recovery.h"
+#include "src/exi/projectExiConnector.h"
+#include "fuzz.h"
+
+static void handleFrame(uint16_t rxbytes) {
+    IPv6Manager(rxbytes);
+    recovery_poll();
+    checkV2GTimeouts();
+}
+
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size) {
+    static uint8_t initialized;
+
+    if (!initialized) {
+        initialized = 1;
+        setSeccIp();
+        projectExiConnector_buildResponseTemplates();
+        buildV2GDispatchTable();
+    }
+    if (size < 1) return 0;
+    resetV2GSession("next input");
+    modem_state = MODEM_V2G_INIT;
+    socOnlySession = data[0] & 1;
+    fuzz_forEachFrame(data + 1, size - 1, handleFrame);
+    return 0;
+}
@@ -0,0 +1,81 @@
+/* Runs a fuzz target over files, for a build without libFuzzer: each argument is an input, or a
+   directory of inputs. Crashes are left to the sanitizers. An input which takes longer than
+   FUZZ_SLOW_MS is reported, it would stall the Timer20ms task on the target. */
+
+#include <dirent.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <time.h>
+#include "fuzz.h"
+
+#ifndef FUZZ_SLOW_MS
+#define FUZZ_SLOW_MS 20
+#endif
+
+static unsigned inputs, slowInputs;
+
+static double nowMs(void) {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1000.0 + ts.tv_nsec / 1e6;
+}
+
+static void runFile(const char *path) {
+	static uint8_t data[1 << 16];
+	FILE *f = fopen(path, "rb");
+	size_t size;
+	double start, ms;
+
+	if (f == NULL) {
+		perror(path);
+		exit(1);
+	}
+	size = fread(data, 1, sizeof(data), f);
+	fclose(f);
+
+	start = nowMs();
+	LLVMFuzzerTestOneInput(data, size);
+	ms = nowMs() - start;
+	inputs++;
+	if (ms > FUZZ_SLOW_MS) {
+		slowInputs++;
+		printf("slow input: %s, %zu bytes, %.1f ms\n", path, size, ms);
+	}
+}
+
+static void run(const char *path) {
+	struct stat st;
+	struct dirent *entry;
+	char child[4096];
+	DIR *dir;
+
+	if (stat(path, &st) != 0) {
+		perror(path);
+		exit(1);
+	}
+	if (!S_ISDIR(st.st_mode)) {
+		runFile(path);
+		return;
+	}
+	dir = opendir(path);
+	while ((entry = readdir(dir)) != NULL) {
+		if (entry->d_name[0] == '.') continue;
+		snprintf(child, sizeof(child), "%s/%s", path, entry->d_name);
+		run(child);
+	}
+	closedir(dir);
+}
+
+int main(int argc, char **argv) {
+	int i;
+
+	if (argc < 2) {
+		fprintf(stderr, "usage: %s <input or directory>...\n", argv[0]);
+		return 2;
+	}
+	for (i = 1; i < argc; i++) run(argv[i]);
+	printf("%u inputs, %u slower than %u ms\n", inputs, slowInputs, FUZZ_SLOW_MS);
+	return slowInputs ? 1 : 0;
+}
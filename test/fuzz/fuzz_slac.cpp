@@ -0,0 +1,27 @@
+// SlacManager: the SLAC with one or more EVs, and the HomePlug messages of our modem. The input is a
+// sequence of frames, see fuzz_forEachFrame(). Each input starts with a configured modem and no EV.
+
+#include <Arduino.h>
+#include "main.h"
+#include "slac.h"
+#include "recovery.h"
+#include "fuzz.h"
+
+static void handleFrame(uint16_t rxbytes) {
+    if (modem_state == MODEM_GET_SW_REQ) { // the modem search of the Timer20ms task
+        composeGetSwReq();
+        ModemsFound = 0;
+        ModemSearchTimer = millis();
+        modem_state = MODEM_WAIT_SW;
+    }
+    SlacManager(rxbytes);
+    checkSlacTimeouts();
+    recovery_poll();
+}
+
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size) {
+    rearmModem("next input");
+    modem_state = MODEM_CONFIGURED;
+    fuzz_forEachFrame(data, size, handleFrame);
+    return 0;
+}
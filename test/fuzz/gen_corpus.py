@@ -0,0 +1,158 @@
+#!/usr/bin/env python3
+"""Writes the seed corpus of the fuzz targets to corpus/<target>/.
+
+The supportedAppProtocolReq is a Hyundai Ioniq capture, as logged by pyPLC. The DIN requests are the
+vectors of test/test_exi, a DC session of a typical EV. The IPv6/TCP and SLAC seeds put them into the
+frames an EV sends, in the order of a session, so the fuzzer starts from inputs which reach deep into
+the state machines.
+"""
+
+import os
+import struct
+
+APPHAND_IONIQ = "8000dbab9371d3234b71d1b981899189d191818991d26b9b3a232b30020000040040"
+
+DIN_REQUESTS = [
+    ("SessionSetupReq", "809a004011d01808000000000400"),
+    ("ServiceDiscoveryReq", "809a0237ab6fbbc04080c11198"),
+    ("ServicePaymentSelectionReq", "809a0237ab6fbbc04080c111b2001280"),
+    ("ContractAuthenticationReq", "809a0237ab6fbbc04080c110b8"),
+    ("ChargeParameterDiscoveryReq", "809a0237ab6fbbc04080c1107190400800c0c378080a0e1b816060a1340602848620200a121f8040c81400"),
+    ("CableCheckReq", "809a0237ab6fbbc04080c11011400800"),
+    ("PreChargeReq", "809a0237ab6fbbc04080c11151400800c14394080c0c0040"),
+    ("PowerDeliveryReq", "809a0237ab6fbbc04080c111322280100800"),
+    ("PowerDeliveryReq-stop", "809a0237ab6fbbc04080c111302280100800"),  # ReadyToChargeState 0
+    ("CurrentDemandReq", "809a0237ab6fbbc04080c110d1400840c0c1f4030509a0300c0c378080a0e1b8160001810480e00c08380480c143b40800"),
+    ("WeldingDetectionReq", "809a0237ab6fbbc04080c11211401400"),
+    ("SessionStopReq", "809a0237ab6fbbc04080c111f0"),
+]
+
+CPD_PROJECTED_FIELDS = 0x0388  # tcp.cpp
+ALL_FIELDS = 0xFFFF
+
+EV_MAC = bytes.fromhex("020000000001")
+EV2_MAC = bytes.fromhex("020000000002")
+SECC_MAC = bytes.fromhex("020000000010")  # myMac of test/fuzz/platform.cpp
+MODEM_MAC = bytes.fromhex("00b052000001")
+EV_MODEM_MAC = bytes.fromhex("00b052000002")
+EV_IP = bytes.fromhex("fe800000000000000000000000000001")
+SECC_IP = bytes.fromhex("fe800000000000000000000000000010")
+EV_PORT = 50000
+
+
+def frames(*frames):
+    """One input: each frame behind its 2 byte length. An empty frame is padded, and only lets 20 ms pass."""
+    return b"".join(struct.pack(">H", len(f)) + f for f in frames)
+
+
+def v2gtp(payloadType, payload):
+    return bytes([0x01, 0xFE]) + struct.pack(">HI", payloadType, len(payload)) + payload
+
+
+def ipv6(nextHeader, payload, src=EV_IP, dst=SECC_IP):
+    eth = SECC_MAC + EV_MAC + b"\x86\xdd"
+    return eth + b"\x60\x00\x00\x00" + struct.pack(">HBB", len(payload), nextHeader, 64) + src + dst + payload
+
+
+def udp(dstPort, payload):
+    return ipv6(0x11, struct.pack(">HHHH", EV_PORT, dstPort, 8 + len(payload), 0) + payload)
+
+
+def tcp(flags, seq, ack, payload=b""):
+    header = struct.pack(">HHIIBBHHH", EV_PORT, 15118, seq, ack, 5 << 4, flags, 0x1000, 0, 0)
+    return ipv6(0x06, header + payload)
+
+
+def neighborSolicitation():
+    return ipv6(0x3A, bytes([0x87, 0, 0, 0, 0, 0, 0, 0]) + SECC_IP, dst=bytes.fromhex("ff0200000000000000000001ff000010"))
+
+
+SYN, ACK, PSH = 0x02, 0x10, 0x08
+SECC_SEQ = 0x01020304  # the sequence number tcp.cpp starts with
+
+
+def tcpSession(messages):
+    seq = 1000
+    out = [neighborSolicitation(), udp(15118, v2gtp(0x9000, b"\x10\x00")), tcp(SYN, seq, 0), tcp(ACK, seq + 1, SECC_SEQ + 1)]
+    seq += 1
+    for m in messages:
+        out.append(tcp(PSH | ACK, seq, SECC_SEQ + 1, m))
+        seq += len(m)
+    return out
+
+
+def homeplug(src, mmtype, payload, dst=SECC_MAC):
+    return dst + src + b"\x88\xe1" + bytes([0x01]) + struct.pack("<H", mmtype) + b"\x00\x00" + payload
+
+
+CM_SET_KEY_CNF = 0x6009
+CM_SLAC_PARAM_REQ = 0x6064
+CM_START_ATTEN_CHAR_IND = 0x606A
+CM_ATTEN_CHAR_RSP = 0x606F
+CM_MNBC_SOUND_IND = 0x6076
+CM_SLAC_MATCH_REQ = 0x607C
+CM_ATTEN_PROFILE_IND = 0x6086
+CM_GET_SW_CNF = 0xA001
+
+
+def slacRun(ev, runId, attenuation, sounds=10, match=True):
+    """The frames of one EV, from the CM_SLAC_PARAM.REQ to the CM_SLAC_MATCH.REQ"""
+    param = homeplug(ev, CM_SLAC_PARAM_REQ, bytes(2) + runId)
+    startAtten = homeplug(ev, CM_START_ATTEN_CHAR_IND, bytes(2) + bytes([sounds, 6, 1]) + ev + runId)
+    out = [param, startAtten]
+    for _ in range(sounds):
+        out.append(homeplug(ev, CM_MNBC_SOUND_IND, bytes(2) + bytes(17) + bytes([0]) + runId))
+        out.append(homeplug(MODEM_MAC, CM_ATTEN_PROFILE_IND, ev + bytes([58, 0]) + bytes([attenuation] * 58)))
+    out.append(homeplug(ev, CM_ATTEN_CHAR_RSP, bytes(2) + ev + runId + bytes(17 + 17) + bytes([0])))
+    if match:
+        mvf = bytes(17) + ev + bytes(17) + SECC_MAC + runId + bytes(8)
+        out.append(homeplug(ev, CM_SLAC_MATCH_REQ, bytes(2) + bytes([0x3E, 0x00]) + mvf))
+    return out
+
+
+def getSwCnf(src):
+    return homeplug(src, CM_GET_SW_CNF, b"\x00\xb0\x52\x00" + b"MAC-QCA7000-1.2.5", dst=b"\xff" * 6)
+
+
+def write(target, name, data):
+    path = os.path.join(os.path.dirname(os.path.abspath(__file__)), "corpus", target)
+    os.makedirs(path, exist_ok=True)
+    with open(os.path.join(path, name), "wb") as f:
+        f.write(data)
+
+
+def main():
+    appHand = bytes.fromhex(APPHAND_IONIQ)
+    din = [(name, bytes.fromhex(h)) for name, h in DIN_REQUESTS]
+    byName = dict(din)
+
+    write("apphand", "ioniq", appHand)
+    for name, m in din:
+        write("din", name, m)
+        write("din_projected", name, struct.pack(">H", CPD_PROJECTED_FIELDS) + m)
+    write("din_projected", "ChargeParameterDiscoveryReq-all", struct.pack(">H", ALL_FIELDS) + byName["ChargeParameterDiscoveryReq"])
+
+    # the first byte selects a SoC-only session
+    session = [v2gtp(0x8001, appHand)] + [v2gtp(0x8001, m) for _, m in din]
+    socOnly = session[:6] + session[-1:]  # up to the ChargeParameterDiscoveryReq, then the SessionStopReq
+    write("ipv6_tcp", "soc-only", b"\x01" + frames(*tcpSession(socOnly)))
+    charge = session[:9] + [v2gtp(0x8001, byName[n]) for n in ("CurrentDemandReq", "PowerDeliveryReq-stop", "WeldingDetectionReq", "SessionStopReq")]
+    write("ipv6_tcp", "dc-charge", b"\x00" + frames(*tcpSession(charge)))
+    # all messages of the session in one segment, and one message split over two segments
+    write("ipv6_tcp", "pipelined", b"\x01" + frames(*tcpSession([b"".join(socOnly)])))
+    write("ipv6_tcp", "segmented", b"\x01" + frames(*tcpSession([session[0][:10], session[0][10:]])))
+
+    setKey = homeplug(MODEM_MAC, CM_SET_KEY_CNF, bytes([0x01]) + bytes(40))
+    runId1, runId2 = bytes(range(1, 9)), bytes(range(11, 19))
+    write("slac", "match", frames(setKey, *slacRun(EV_MAC, runId1, 20), getSwCnf(MODEM_MAC), getSwCnf(EV_MODEM_MAC)))
+    ev1, ev2 = slacRun(EV_MAC, runId1, 20), slacRun(EV2_MAC, runId2, 40)
+    write("slac", "two-evs", frames(*[f for pair in zip(ev1, ev2) for f in pair]))
+    # the EV we hear worse asks first, it is answered all the same
+    write("slac", "two-evs-far-first", frames(*[f for pair in zip(ev2, ev1) for f in pair]))
+    # three sounds, then silence: the sound timer, the repeats of the CM_ATTEN_CHAR.IND, and the failed run
+    idle = [b""] * 100  # 20 ms each
+    write("slac", "lost-sounds", frames(*slacRun(EV_MAC, runId1, 20)[:8], *idle))
+
+
+if __name__ == "__main__":
+    main()
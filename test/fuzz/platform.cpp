@@ -0,0 +1,65 @@
+/* What main.cpp provides to the protocol code on the target: the buffers, the modem and the clock.
+   Frames to the modem are dropped. The clock only moves when a fuzz target advances it. */
+
+#include <stdlib.h>
+#include <Arduino.h>
+#include <WebSerial.h>
+#include "main.h"
+#include "fuzz.h"
+
+FuzzWebSerial WebSerial(getenv("FUZZ_LOG") != NULL);
+
+uint8_t txbuffer[3164], rxbuffer[3164];
+uint8_t modem_state;
+uint8_t myMac[6] = { 0x02, 0x00, 0x00, 0x00, 0x00, 0x10 };
+uint8_t pevMac[6];
+uint8_t EVCCID[6];
+uint8_t EVSOC = 0;
+unsigned long plugInTimer = 0;
+
+static unsigned long fuzzMs = 1000;
+
+unsigned long millis(void) { return fuzzMs; }
+unsigned long micros(void) { return fuzzMs * 1000; }
+long random(long max) { return max / 2; }
+
+void fuzz_advanceMs(unsigned long ms) { fuzzMs += ms; }
+
+void qcaspi_write_burst(uint8_t *src, uint32_t len) { (void)src; (void)len; }
+
+void setMacAt(uint8_t *mac, uint16_t offset) {
+    for (uint8_t i=0; i<6; i++) txbuffer[offset+i]=mac[i];
+}
+
+String macArrayToString(const uint8_t mac[6]) {
+    char macStr[13];
+    snprintf(macStr, sizeof(macStr), "%02x%02x%02x%02x%02x%02x", mac[0], mac[1], mac[2], mac[3], mac[4], mac[5]);
+    return String(macStr);
+}
+
+void sendSocCallback(float current_soc, float full_soc, float energy_capacity, float energy_request, const String& evccid, uint8_t confidence) {
+    (void)current_soc; (void)full_soc; (void)energy_capacity; (void)energy_request; (void)evccid; (void)confidence;
+}
+
+void ModemReset() {}
+
+/* Hands each frame of the input to frameHandler, like the Timer20ms task does with a burst from the modem.
+   A frame is a 2 byte length (big endian) and the frame. Frames are padded to the 60 bytes of the smallest
+   Ethernet frame, the managers only see frames of at least that size. */
+void fuzz_forEachFrame(const uint8_t *data, size_t size, void (*frameHandler)(uint16_t rxbytes)) {
+    uint16_t len;
+
+    while (size >= 2) {
+        len = (data[0] << 8) | data[1];
+        data += 2;
+        size -= 2;
+        if (len > size) len = size;
+        if (len > QCA7K_BUFFER_SIZE - 14) return;
+        memset(rxbuffer, 0, sizeof(rxbuffer));
+        memcpy(rxbuffer, data, len);
+        data += len;
+        size -= len;
+        frameHandler(len < 60 ? 60 : len);
+        fuzz_advanceMs(TIMER_POLL_MS);
+    }
+}
@@ -0,0 +1,13 @@
+/* The part of the Arduino core the protocol code uses, for the host build of the fuzz targets */
+#pragma once
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <string>
+
+typedef std::string String;
+
+unsigned long millis(void);
+unsigned long micros(void);
+long random(long max);
@@ -0,0 +1,24 @@
+/* Every message is formatted, and only printed with FUZZ_LOG set in the environment */
+#pragma once
+#include <stdio.h>
+#include <stdarg.h>
+#include <string>
+
+class FuzzWebSerial {
+public:
+    explicit FuzzWebSerial(bool log) : log(log) {}
+    void printf(const char *format, ...) {
+        char line[512];
+        va_list args;
+        va_start(args, format);
+        vsnprintf(line, sizeof(line), format, args);
+        va_end(args);
+        if (log) fputs(line, stdout);
+    }
+    void println(const char *s) { if (log) puts(s); }
+    void println(const std::string &s) { println(s.c_str()); }
+private:
+    bool log;
+};
+
+extern FuzzWebSerial WebSerial;
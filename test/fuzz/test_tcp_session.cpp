@@ -0,0 +1,177 @@
+// Host test of the TCP connection which carries the V2G session: a segment the EV sends again, because our
+// ACK got lost, must not end the session, and an EV which does not stop when we ask it to must not hold
+// the session. Built and run by make check, with the stubs of the fuzz targets.
+
+#include <stdio.h>
+#include <string.h>
+#include <Arduino.h>
+#include "main.h"
+#include "ipv6.h"
+#include "tcp.h"
+#include "recovery.h"
+#include "src/exi/projectExiConnector.h"
+#include "fuzz.h"
+
+// see tcp.cpp
+#define TCP_STATE_ESTABLISHED 2
+#define stateWaitForSessionSetupRequest 1
+#define stateWaitForServiceDiscoveryRequest 2
+#define stateWaitForServicePaymentSelectionRequest 3
+#define stateWaitForSupportedApplicationProtocolRequest 0
+#define stateWaitForSessionStopRequest 11
+
+#define TCP_FLAG_SYN 0x02
+#define TCP_FLAG_PSH 0x08
+#define TCP_FLAG_ACK 0x10
+
+extern uint8_t fsmState;
+extern uint8_t tcpState;
+extern uint8_t recoveryFailures[RECOVER_LAYERS];
+
+// the vectors of test/test_exi
+static const char *appHandIoniq = "8000dbab9371d3234b71d1b981899189d191818991d26b9b3a232b30020000040040";
+static const char *sessionSetupReq = "809a004011d01808000000000400";
+static const char *serviceDiscoveryReq = "809a0237ab6fbbc04080c11198";
+static const char *servicePaymentSelectionReq = "809a0237ab6fbbc04080c111b2001280";
+static const char *contractAuthenticationReq = "809a0237ab6fbbc04080c110b8";
+static const char *chargeParameterDiscoveryReq =
+    "809a0237ab6fbbc04080c1107190400800c0c378080a0e1b816060a1340602848620200a121f8040c81400";
+static const char *cableCheckReq = "809a0237ab6fbbc04080c11011400800";
+
+static const uint8_t evMac[6] = { 0x02, 0x00, 0x00, 0x00, 0x00, 0x01 };
+static const uint8_t evIp[16] = { 0xfe, 0x80, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x01 };
+#define EV_PORT 50000
+#define SECC_SEQ 0x01020304 /* the sequence number tcp.cpp starts with */
+
+static uint32_t evSeq;
+static int failures;
+
+#define CHECK(cond) do { if (!(cond)) { printf("%s:%d: %s\n", __FILE__, __LINE__, #cond); failures++; } } while (0)
+
+static uint16_t fromHex(const char *hex, uint8_t *out) {
+    uint16_t len = 0;
+    unsigned int byte;
+
+    for (; hex[0] && hex[1]; hex += 2) {
+        sscanf(hex, "%2x", &byte);
+        out[len++] = byte;
+    }
+    return len;
+}
+
+static void putU32(uint8_t *p, uint32_t value) {
+    p[0] = value >> 24; p[1] = value >> 16; p[2] = value >> 8; p[3] = value;
+}
+
+/* Hands one TCP segment from the EV to IPv6Manager, like the Timer20ms task does with a frame from the modem. */
+static void tcpFromEv(uint8_t flags, uint32_t seq, const uint8_t *payload, uint16_t payloadLen) {
+    uint16_t len = 54 + 20 + payloadLen;
+
+    if (len < 60) len = 60; // the smallest Ethernet frame
+    memset(rxbuffer, 0, len);
+    memcpy(rxbuffer, myMac, 6);
+    memcpy(rxbuffer+6, evMac, 6);
+    rxbuffer[12] = 0x86; rxbuffer[13] = 0xdd;
+    rxbuffer[14] = 0x60;
+    rxbuffer[18] = (20 + payloadLen) >> 8; rxbuffer[19] = 20 + payloadLen;
+    rxbuffer[20] = 0x06; // TCP
+    rxbuffer[21] = 64;
+    memcpy(rxbuffer+22, evIp, 16);
+    memcpy(rxbuffer+38, SeccIp, 16);
+    rxbuffer[54] = EV_PORT >> 8; rxbuffer[55] = EV_PORT & 0xff;
+    rxbuffer[56] = 15118 >> 8; rxbuffer[57] = 15118 & 0xff;
+    putU32(rxbuffer+58, seq);
+    if (flags & TCP_FLAG_ACK) putU32(rxbuffer+62, SECC_SEQ + 1);
+    rxbuffer[66] = 5 << 4;
+    rxbuffer[67] = flags;
+    rxbuffer[68] = 0x10; // window
+    if (payloadLen) memcpy(rxbuffer+74, payload, payloadLen);
+    IPv6Manager(len);
+    recovery_poll();
+    fuzz_advanceMs(TIMER_POLL_MS);
+}
+
+/* A V2GTP message in one segment. The sequence number only moves on when the EV is not repeating itself. */
+static void requestFromEv(const char *exiHex, uint8_t again) {
+    uint8_t msg[8 + 200];
+    uint16_t len = fromHex(exiHex, msg + 8);
+
+    msg[0] = 0x01; msg[1] = 0xfe; msg[2] = 0x80; msg[3] = 0x01;
+    msg[4] = 0; msg[5] = 0; msg[6] = len >> 8; msg[7] = len;
+    if (again) evSeq -= 8 + len;
+    tcpFromEv(TCP_FLAG_PSH | TCP_FLAG_ACK, evSeq, msg, 8 + len);
+    evSeq += 8 + len;
+}
+
+static void connect(void) {
+    resetV2GSession("next test");
+    memset(recoveryFailures, 0, RECOVER_LAYERS);
+    modem_state = MODEM_V2G_INIT;
+    evSeq = 1000;
+    tcpFromEv(TCP_FLAG_SYN, evSeq, NULL, 0);
+    evSeq++;
+    tcpFromEv(TCP_FLAG_ACK, evSeq, NULL, 0);
+}
+
+static void test_repeatedFirstRequest(void) {
+    connect();
+    requestFromEv(appHandIoniq, 0);
+    CHECK(fsmState == stateWaitForSessionSetupRequest);
+    requestFromEv(appHandIoniq, 1);
+    CHECK(fsmState == stateWaitForSessionSetupRequest);
+    CHECK(tcpState == TCP_STATE_ESTABLISHED);
+    CHECK(recoveryFailures[RECOVER_V2G] == 0);
+    requestFromEv(sessionSetupReq, 0);
+    CHECK(fsmState == stateWaitForServiceDiscoveryRequest);
+}
+
+static void test_repeatedRequestInSession(void) {
+    connect();
+    requestFromEv(appHandIoniq, 0);
+    requestFromEv(sessionSetupReq, 0);
+    CHECK(fsmState == stateWaitForServiceDiscoveryRequest);
+    requestFromEv(sessionSetupReq, 1);
+    CHECK(fsmState == stateWaitForServiceDiscoveryRequest);
+    CHECK(tcpState == TCP_STATE_ESTABLISHED);
+    CHECK(recoveryFailures[RECOVER_V2G] == 0);
+    requestFromEv(serviceDiscoveryReq, 0);
+    CHECK(fsmState == stateWaitForServicePaymentSelectionRequest);
+}
+
+/* SoC only: the EV goes on with its CableCheckReq after we asked it to stop, and is answered Ongoing */
+static void test_evIgnoresStop(void) {
+    uint8_t n;
+
+    connect();
+    socOnlySession = 1;
+    requestFromEv(appHandIoniq, 0);
+    requestFromEv(sessionSetupReq, 0);
+    requestFromEv(serviceDiscoveryReq, 0);
+    requestFromEv(servicePaymentSelectionReq, 0);
+    requestFromEv(contractAuthenticationReq, 0);
+    requestFromEv(chargeParameterDiscoveryReq, 0);
+    CHECK(fsmState == stateWaitForSessionStopRequest);
+    for (n = 0; n < 60 && fsmState == stateWaitForSessionStopRequest; n++) {
+        requestFromEv(cableCheckReq, 0);
+        fuzz_advanceMs(500);
+        checkV2GTimeouts();
+    }
+    CHECK(n <= 12); // within V2G_STOP_TIMEOUT_MS of tcp.cpp, and not at the 60 s sequence timeout
+    CHECK(fsmState == stateWaitForSupportedApplicationProtocolRequest);
+    CHECK(!v2gSessionRunning());
+    CHECK(recoveryFailures[RECOVER_V2G] == 0);
+    socOnlySession = 0;
+}
+
+int main(void) {
+    setSeccIp();
+    projectExiConnector_buildResponseTemplates();
+    buildV2GDispatchTable();
+
+    test_repeatedFirstRequest();
+    test_repeatedRequestInSession();
+    test_evIgnoresStop();
+    if (failures) return 1;
+    printf("3 tests passed\n");
+    return 0;
+}
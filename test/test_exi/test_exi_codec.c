@@ -0,0 +1,292 @@
+/*
+ * Host tests of the EXI codec: pio test -e native
+ *
+ * Each vector is the EXI stream of a message behind its V2GTP header. The tests decode it and check
+ * the values an EV put into it, field by field. So a codec change which alters what the SECC reads
+ * from a car fails here, not at the car.
+ *
+ * appHandIoniq is a capture of a Hyundai Ioniq, as logged by pyPLC. The DIN requests are a DC session
+ * as a typical EV runs it, built from the values checked below: SessionID 00 in the SessionSetupReq,
+ * DE AD BE EF 01 02 03 04 afterwards, SoC 32 %, 410 V / 350 A / 150 kW limits. Captures from more cars
+ * go next to them, each with a test of its values.
+ */
+
+#include <unity.h>
+#include <string.h>
+
+#include "projectExiConnector.h"
+#include "appHandNegotiation.h"
+
+static struct exiCodecContext ctx;
+
+/* supportedAppProtocolReq of a Hyundai Ioniq: DIN 70121 only */
+static const uint8_t appHandIoniq[] = {
+	0x80, 0x00, 0xDB, 0xAB, 0x93, 0x71, 0xD3, 0x23, 0x4B, 0x71, 0xD1, 0xB9, 0x81, 0x89, 0x91, 0x89, 0xD1, 0x91, 0x81, 0x89,
+	0x91, 0xD2, 0x6B, 0x9B, 0x3A, 0x23, 0x2B, 0x30, 0x02, 0x00, 0x00, 0x04, 0x00, 0x40 };
+static const uint8_t dinSessionSetupReq[] = {
+	0x80, 0x9A, 0x00, 0x40, 0x11, 0xD0, 0x18, 0x08, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00 };
+static const uint8_t dinServiceDiscoveryReq[] = {
+	0x80, 0x9A, 0x02, 0x37, 0xAB, 0x6F, 0xBB, 0xC0, 0x40, 0x80, 0xC1, 0x11, 0x98 };
+static const uint8_t dinServicePaymentSelectionReq[] = {
+	0x80, 0x9A, 0x02, 0x37, 0xAB, 0x6F, 0xBB, 0xC0, 0x40, 0x80, 0xC1, 0x11, 0xB2, 0x00, 0x12, 0x80 };
+static const uint8_t dinContractAuthenticationReq[] = {
+	0x80, 0x9A, 0x02, 0x37, 0xAB, 0x6F, 0xBB, 0xC0, 0x40, 0x80, 0xC1, 0x10, 0xB8 };
+static const uint8_t dinChargeParameterDiscoveryReq[] = {
+	0x80, 0x9A, 0x02, 0x37, 0xAB, 0x6F, 0xBB, 0xC0, 0x40, 0x80, 0xC1, 0x10, 0x71, 0x90, 0x40, 0x08, 0x00, 0xC0, 0xC3, 0x78,
+	0x08, 0x0A, 0x0E, 0x1B, 0x81, 0x60, 0x60, 0xA1, 0x34, 0x06, 0x02, 0x84, 0x86, 0x20, 0x20, 0x0A, 0x12, 0x1F, 0x80, 0x40,
+	0xC8, 0x14, 0x00 };
+static const uint8_t dinCableCheckReq[] = {
+	0x80, 0x9A, 0x02, 0x37, 0xAB, 0x6F, 0xBB, 0xC0, 0x40, 0x80, 0xC1, 0x10, 0x11, 0x40, 0x08, 0x00 };
+static const uint8_t dinPreChargeReq[] = {
+	0x80, 0x9A, 0x02, 0x37, 0xAB, 0x6F, 0xBB, 0xC0, 0x40, 0x80, 0xC1, 0x11, 0x51, 0x40, 0x08, 0x00, 0xC1, 0x43, 0x94, 0x08,
+	0x0C, 0x0C, 0x00, 0x40 };
+static const uint8_t dinPowerDeliveryReq[] = {
+	0x80, 0x9A, 0x02, 0x37, 0xAB, 0x6F, 0xBB, 0xC0, 0x40, 0x80, 0xC1, 0x11, 0x32, 0x22, 0x80, 0x10, 0x08, 0x00 };
+static const uint8_t dinCurrentDemandReq[] = {
+	0x80, 0x9A, 0x02, 0x37, 0xAB, 0x6F, 0xBB, 0xC0, 0x40, 0x80, 0xC1, 0x10, 0xD1, 0x40, 0x08, 0x40, 0xC0, 0xC1, 0xF4, 0x03,
+	0x05, 0x09, 0xA0, 0x30, 0x0C, 0x0C, 0x37, 0x80, 0x80, 0xA0, 0xE1, 0xB8, 0x16, 0x00, 0x01, 0x81, 0x04, 0x80, 0xE0, 0x0C,
+	0x08, 0x38, 0x04, 0x80, 0xC1, 0x43, 0xB4, 0x08, 0x00 };
+static const uint8_t dinWeldingDetectionReq[] = {
+	0x80, 0x9A, 0x02, 0x37, 0xAB, 0x6F, 0xBB, 0xC0, 0x40, 0x80, 0xC1, 0x12, 0x11, 0x40, 0x14, 0x00 };
+static const uint8_t dinSessionStopReq[] = {
+	0x80, 0x9A, 0x02, 0x37, 0xAB, 0x6F, 0xBB, 0xC0, 0x40, 0x80, 0xC1, 0x11, 0xF0 };
+
+static const uint8_t evSessionId[] = { 0xDE, 0xAD, 0xBE, 0xEF, 0x01, 0x02, 0x03, 0x04 };
+
+#define body (ctx.arena.din.V2G_Message.Body)
+
+void setUp(void) {
+	exiCodec_init(&ctx);
+}
+
+void tearDown(void) {
+	exiCodec_resetArena(&ctx);
+}
+
+/* Decodes a complete message, which must be consumed to its last byte */
+static void decodeAppHand(const uint8_t *bytes, uint16_t len) {
+	ctx.streamDec.data = (uint8_t *)bytes;
+	ctx.streamDec.size = len;
+	exiCodec_decode_appHandExiDocument(&ctx);
+	TEST_ASSERT_EQUAL_INT(0, ctx.errn);
+	TEST_ASSERT_EQUAL_UINT(len, ctx.streamDecPos);
+}
+
+static void decodeDin(const uint8_t *bytes, uint16_t len) {
+	ctx.streamDec.data = (uint8_t *)bytes;
+	ctx.streamDec.size = len;
+	exiCodec_decode_DinExiDocument(&ctx);
+	TEST_ASSERT_EQUAL_INT(0, ctx.errn);
+	TEST_ASSERT_EQUAL_UINT(len, ctx.streamDecPos);
+	TEST_ASSERT_EQUAL_UINT(1, ctx.arena.din.V2G_Message_isUsed);
+}
+
+static void assertSessionId(void) {
+	TEST_ASSERT_EQUAL_UINT(sizeof(evSessionId), ctx.arena.din.V2G_Message.Header.SessionID.bytesLen);
+	TEST_ASSERT_EQUAL_HEX8_ARRAY(evSessionId, ctx.arena.din.V2G_Message.Header.SessionID.bytes, sizeof(evSessionId));
+}
+
+static void assertPhysicalValue(int16_t value, int8_t multiplier, uint8_t unit, const struct dinPhysicalValueType *pv) {
+	TEST_ASSERT_EQUAL_INT16(value, pv->Value);
+	TEST_ASSERT_EQUAL_INT8(multiplier, pv->Multiplier);
+	TEST_ASSERT_EQUAL_UINT(1, pv->Unit_isUsed);
+	TEST_ASSERT_EQUAL_UINT(unit, pv->Unit);
+}
+
+static void assertEVStatus(uint8_t ready, int8_t soc, const struct dinDC_EVStatusType *status) {
+	TEST_ASSERT_EQUAL_UINT(ready, status->EVReady);
+	TEST_ASSERT_EQUAL_UINT(dinDC_EVErrorCodeType_NO_ERROR, status->EVErrorCode);
+	TEST_ASSERT_EQUAL_INT8(soc, status->EVRESSSOC);
+}
+
+static void test_appHand_ioniq(void) {
+	const struct appHandAppProtocolType *app;
+	struct appHandNegotiation result;
+
+	decodeAppHand(appHandIoniq, sizeof(appHandIoniq));
+	TEST_ASSERT_EQUAL_UINT(1, ctx.arena.appHand.supportedAppProtocolReq_isUsed);
+	TEST_ASSERT_EQUAL_UINT(1, ctx.arena.appHand.supportedAppProtocolReq.AppProtocol.arrayLen);
+	app = &ctx.arena.appHand.supportedAppProtocolReq.AppProtocol.array[0];
+	TEST_ASSERT_EQUAL_UINT(25, app->ProtocolNamespace.charactersLen);
+	TEST_ASSERT_EQUAL_MEMORY("urn:din:70121:2012:MsgDef", app->ProtocolNamespace.characters, 25);
+	TEST_ASSERT_EQUAL_UINT(2, app->VersionNumberMajor);
+	TEST_ASSERT_EQUAL_UINT(0, app->VersionNumberMinor);
+	TEST_ASSERT_EQUAL_UINT(1, app->SchemaID);
+	TEST_ASSERT_EQUAL_UINT(1, app->Priority);
+
+	appHand_negotiate(&ctx.arena.appHand.supportedAppProtocolReq, &result);
+	TEST_ASSERT_EQUAL_UINT(APPHAND_PROTOCOL_DIN, result.protocol);
+	TEST_ASSERT_EQUAL_UINT(1, result.SchemaID);
+	TEST_ASSERT_EQUAL_UINT(appHandresponseCodeType_OK_SuccessfulNegotiation, result.responseCode);
+}
+
+static void test_din_SessionSetupReq(void) {
+	static const uint8_t evccid[] = { 0x02, 0x00, 0x00, 0x00, 0x00, 0x01 };
+
+	decodeDin(dinSessionSetupReq, sizeof(dinSessionSetupReq));
+	TEST_ASSERT_EQUAL_UINT(1, ctx.arena.din.V2G_Message.Header.SessionID.bytesLen);
+	TEST_ASSERT_EQUAL_HEX8(0x00, ctx.arena.din.V2G_Message.Header.SessionID.bytes[0]);
+	TEST_ASSERT_EQUAL_UINT(1, body.SessionSetupReq_isUsed);
+	TEST_ASSERT_EQUAL_UINT(sizeof(evccid), body.SessionSetupReq.EVCCID.bytesLen);
+	TEST_ASSERT_EQUAL_HEX8_ARRAY(evccid, body.SessionSetupReq.EVCCID.bytes, sizeof(evccid));
+}
+
+static void test_din_ServiceDiscoveryReq(void) {
+	decodeDin(dinServiceDiscoveryReq, sizeof(dinServiceDiscoveryReq));
+	assertSessionId();
+	TEST_ASSERT_EQUAL_UINT(1, body.ServiceDiscoveryReq_isUsed);
+	TEST_ASSERT_EQUAL_UINT(0, body.ServiceDiscoveryReq.ServiceScope_isUsed);
+	TEST_ASSERT_EQUAL_UINT(0, body.ServiceDiscoveryReq.ServiceCategory_isUsed);
+}
+
+static void test_din_ServicePaymentSelectionReq(void) {
+	decodeDin(dinServicePaymentSelectionReq, sizeof(dinServicePaymentSelectionReq));
+	assertSessionId();
+	TEST_ASSERT_EQUAL_UINT(1, body.ServicePaymentSelectionReq_isUsed);
+	TEST_ASSERT_EQUAL_UINT(dinpaymentOptionType_ExternalPayment, body.ServicePaymentSelectionReq.SelectedPaymentOption);
+	TEST_ASSERT_EQUAL_UINT(1, body.ServicePaymentSelectionReq.SelectedServiceList.SelectedService.arrayLen);
+	TEST_ASSERT_EQUAL_UINT(1, body.ServicePaymentSelectionReq.SelectedServiceList.SelectedService.array[0].ServiceID);
+}
+
+static void test_din_ContractAuthenticationReq(void) {
+	decodeDin(dinContractAuthenticationReq, sizeof(dinContractAuthenticationReq));
+	assertSessionId();
+	TEST_ASSERT_EQUAL_UINT(1, body.ContractAuthenticationReq_isUsed);
+	TEST_ASSERT_EQUAL_UINT(0, body.ContractAuthenticationReq.GenChallenge_isUsed);
+}
+
+static void test_din_ChargeParameterDiscoveryReq(void) {
+	const struct dinDC_EVChargeParameterType *p = &body.ChargeParameterDiscoveryReq.DC_EVChargeParameter;
+
+	decodeDin(dinChargeParameterDiscoveryReq, sizeof(dinChargeParameterDiscoveryReq));
+	assertSessionId();
+	TEST_ASSERT_EQUAL_UINT(1, body.ChargeParameterDiscoveryReq_isUsed);
+	TEST_ASSERT_EQUAL_UINT(dinEVRequestedEnergyTransferType_DC_extended, body.ChargeParameterDiscoveryReq.EVRequestedEnergyTransferType);
+	TEST_ASSERT_EQUAL_UINT(1, body.ChargeParameterDiscoveryReq.DC_EVChargeParameter_isUsed);
+	assertEVStatus(0, 32, &p->DC_EVStatus);
+	assertPhysicalValue(350, 0, dinunitSymbolType_A, &p->EVMaximumCurrentLimit);
+	assertPhysicalValue(410, 0, dinunitSymbolType_V, &p->EVMaximumVoltageLimit);
+	TEST_ASSERT_EQUAL_UINT(1, p->EVMaximumPowerLimit_isUsed);
+	assertPhysicalValue(1500, 2, dinunitSymbolType_W, &p->EVMaximumPowerLimit);
+	TEST_ASSERT_EQUAL_UINT(1, p->EVEnergyCapacity_isUsed);
+	assertPhysicalValue(580, 2, dinunitSymbolType_Wh, &p->EVEnergyCapacity);
+	TEST_ASSERT_EQUAL_UINT(1, p->EVEnergyRequest_isUsed);
+	assertPhysicalValue(380, 2, dinunitSymbolType_Wh, &p->EVEnergyRequest);
+	TEST_ASSERT_EQUAL_UINT(1, p->FullSOC_isUsed);
+	TEST_ASSERT_EQUAL_INT8(100, p->FullSOC);
+	TEST_ASSERT_EQUAL_UINT(1, p->BulkSOC_isUsed);
+	TEST_ASSERT_EQUAL_INT8(80, p->BulkSOC);
+}
+
+/* The projection decoder walks the same grammar with its own code, it must read the same values */
+static void test_din_ChargeParameterDiscoveryReq_projected(void) {
+	const struct dinProjectedChargeParameterDiscoveryReq *cpd = &ctx.projDec.Body.ChargeParameterDiscoveryReq;
+	uint16_t fields = DIN_PROJ_CPD_EVRESSSOC | DIN_PROJ_CPD_FULLSOC | DIN_PROJ_CPD_EVENERGYREQUEST | DIN_PROJ_CPD_EVENERGYCAPACITY;
+
+	ctx.streamDec.data = (uint8_t *)dinChargeParameterDiscoveryReq;
+	ctx.streamDec.size = sizeof(dinChargeParameterDiscoveryReq);
+	exiCodec_decode_DinProjectedExiDocument(&ctx, fields);
+	TEST_ASSERT_EQUAL_INT(0, ctx.errn);
+	TEST_ASSERT_EQUAL_UINT(sizeof(dinChargeParameterDiscoveryReq), ctx.streamDecPos);
+	TEST_ASSERT_EQUAL_UINT(sizeof(evSessionId), ctx.projDec.SessionIDLen);
+	TEST_ASSERT_EQUAL_HEX8_ARRAY(evSessionId, ctx.projDec.SessionID, sizeof(evSessionId));
+	TEST_ASSERT_EQUAL_UINT(DIN_PROJ_BODY_CHARGEPARAMETERDISCOVERYREQ, ctx.projDec.bodyElement);
+	TEST_ASSERT_EQUAL_HEX16(fields, cpd->fieldsUsed);
+	TEST_ASSERT_EQUAL_INT8(32, cpd->EVRESSSOC);
+	TEST_ASSERT_EQUAL_INT8(100, cpd->FullSOC);
+	TEST_ASSERT_EQUAL_INT16(580, cpd->EVEnergyCapacity.Value);
+	TEST_ASSERT_EQUAL_INT8(2, cpd->EVEnergyCapacity.Multiplier);
+	TEST_ASSERT_EQUAL_INT16(380, cpd->EVEnergyRequest.Value);
+	TEST_ASSERT_EQUAL_INT8(2, cpd->EVEnergyRequest.Multiplier);
+}
+
+static void test_din_CableCheckReq(void) {
+	decodeDin(dinCableCheckReq, sizeof(dinCableCheckReq));
+	assertSessionId();
+	TEST_ASSERT_EQUAL_UINT(1, body.CableCheckReq_isUsed);
+	assertEVStatus(1, 32, &body.CableCheckReq.DC_EVStatus);
+}
+
+static void test_din_PreChargeReq(void) {
+	decodeDin(dinPreChargeReq, sizeof(dinPreChargeReq));
+	assertSessionId();
+	TEST_ASSERT_EQUAL_UINT(1, body.PreChargeReq_isUsed);
+	assertEVStatus(1, 32, &body.PreChargeReq.DC_EVStatus);
+	assertPhysicalValue(357, 0, dinunitSymbolType_V, &body.PreChargeReq.EVTargetVoltage);
+	assertPhysicalValue(1, 0, dinunitSymbolType_A, &body.PreChargeReq.EVTargetCurrent);
+}
+
+static void test_din_PowerDeliveryReq(void) {
+	decodeDin(dinPowerDeliveryReq, sizeof(dinPowerDeliveryReq));
+	assertSessionId();
+	TEST_ASSERT_EQUAL_UINT(1, body.PowerDeliveryReq_isUsed);
+	TEST_ASSERT_EQUAL_UINT(1, body.PowerDeliveryReq.ReadyToChargeState);
+	TEST_ASSERT_EQUAL_UINT(0, body.PowerDeliveryReq.ChargingProfile_isUsed);
+	TEST_ASSERT_EQUAL_UINT(1, body.PowerDeliveryReq.DC_EVPowerDeliveryParameter_isUsed);
+	assertEVStatus(1, 32, &body.PowerDeliveryReq.DC_EVPowerDeliveryParameter.DC_EVStatus);
+	TEST_ASSERT_EQUAL_UINT(0, body.PowerDeliveryReq.DC_EVPowerDeliveryParameter.ChargingComplete);
+}
+
+static void test_din_CurrentDemandReq(void) {
+	const struct dinCurrentDemandReqType *cd = &body.CurrentDemandReq;
+
+	decodeDin(dinCurrentDemandReq, sizeof(dinCurrentDemandReq));
+	assertSessionId();
+	TEST_ASSERT_EQUAL_UINT(1, body.CurrentDemandReq_isUsed);
+	assertEVStatus(1, 33, &cd->DC_EVStatus);
+	assertPhysicalValue(125, 0, dinunitSymbolType_A, &cd->EVTargetCurrent);
+	assertPhysicalValue(365, 0, dinunitSymbolType_V, &cd->EVTargetVoltage);
+	TEST_ASSERT_EQUAL_UINT(1, cd->EVMaximumVoltageLimit_isUsed);
+	assertPhysicalValue(410, 0, dinunitSymbolType_V, &cd->EVMaximumVoltageLimit);
+	TEST_ASSERT_EQUAL_UINT(1, cd->EVMaximumCurrentLimit_isUsed);
+	assertPhysicalValue(350, 0, dinunitSymbolType_A, &cd->EVMaximumCurrentLimit);
+	TEST_ASSERT_EQUAL_UINT(1, cd->EVMaximumPowerLimit_isUsed);
+	assertPhysicalValue(1500, 2, dinunitSymbolType_W, &cd->EVMaximumPowerLimit);
+	TEST_ASSERT_EQUAL_UINT(1, cd->RemainingTimeToFullSoC_isUsed);
+	assertPhysicalValue(3600, 0, dinunitSymbolType_s, &cd->RemainingTimeToFullSoC);
+	TEST_ASSERT_EQUAL_UINT(1, cd->RemainingTimeToBulkSoC_isUsed);
+	assertPhysicalValue(2400, 0, dinunitSymbolType_s, &cd->RemainingTimeToBulkSoC);
+	TEST_ASSERT_EQUAL_UINT(0, cd->ChargingComplete);
+	TEST_ASSERT_EQUAL_UINT(1, cd->BulkChargingComplete_isUsed);
+	TEST_ASSERT_EQUAL_UINT(0, cd->BulkChargingComplete);
+}
+
+static void test_din_WeldingDetectionReq(void) {
+	decodeDin(dinWeldingDetectionReq, sizeof(dinWeldingDetectionReq));
+	assertSessionId();
+	TEST_ASSERT_EQUAL_UINT(1, body.WeldingDetectionReq_isUsed);
+	assertEVStatus(1, 80, &body.WeldingDetectionReq.DC_EVStatus);
+}
+
+static void test_din_SessionStopReq(void) {
+	decodeDin(dinSessionStopReq, sizeof(dinSessionStopReq));
+	assertSessionId();
+	TEST_ASSERT_EQUAL_UINT(1, body.SessionStopReq_isUsed);
+}
+
+/* A message cut short must not decode as if it were complete */
+static void test_din_truncated(void) {
+	ctx.streamDec.data = (uint8_t *)dinCurrentDemandReq;
+	ctx.streamDec.size = sizeof(dinCurrentDemandReq) - 8;
+	exiCodec_decode_DinExiDocument(&ctx);
+	TEST_ASSERT_NOT_EQUAL(0, ctx.errn);
+}
+
+int main(int argc, char **argv) {
+	UNITY_BEGIN();
+	RUN_TEST(test_appHand_ioniq);
+	RUN_TEST(test_din_SessionSetupReq);
+	RUN_TEST(test_din_ServiceDiscoveryReq);
+	RUN_TEST(test_din_ServicePaymentSelectionReq);
+	RUN_TEST(test_din_ContractAuthenticationReq);
+	RUN_TEST(test_din_ChargeParameterDiscoveryReq);
+	RUN_TEST(test_din_ChargeParameterDiscoveryReq_projected);
+	RUN_TEST(test_din_CableCheckReq);
+	RUN_TEST(test_din_PreChargeReq);
+	RUN_TEST(test_din_PowerDeliveryReq);
+	RUN_TEST(test_din_CurrentDemandReq);
+	RUN_TEST(test_din_WeldingDetectionReq);
+	RUN_TEST(test_din_SessionStopReq);
+	RUN_TEST(test_din_truncated);
+	return UNITY_END();
+}